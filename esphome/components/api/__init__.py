@@ -35,6 +35,11 @@ HomeAssistantServiceCallAction = api_ns.class_(
     "HomeAssistantServiceCallAction", automation.Action
 )
 APIConnectedCondition = api_ns.class_("APIConnectedCondition", Condition)
+SendQueueOverflow = api_ns.enum("SendQueueOverflow")
+SEND_QUEUE_OVERFLOWS = {
+    "DROP": SendQueueOverflow.SEND_QUEUE_OVERFLOW_DROP,
+    "DISCONNECT": SendQueueOverflow.SEND_QUEUE_OVERFLOW_DISCONNECT,
+}
 
 UserServiceTrigger = api_ns.class_("UserServiceTrigger", automation.Trigger)
 ListEntitiesServicesArgument = api_ns.class_("ListEntitiesServicesArgument")
@@ -49,6 +54,10 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 CONF_ENCRYPTION = "encryption"
+CONF_BATCH_DELAY = "batch_delay"
+CONF_SEND_QUEUE_LIMIT = "send_queue_limit"
+CONF_SEND_QUEUE_OVERFLOW = "send_queue_overflow"
+CONF_LIST_ENTITIES_CACHE = "list_entities_cache"
 
 
 def validate_encryption_key(value):
@@ -91,6 +100,14 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_BATCH_DELAY, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_SEND_QUEUE_LIMIT, default="8kB"): cv.validate_bytes,
+            cv.Optional(CONF_SEND_QUEUE_OVERFLOW, default="DROP"): cv.enum(
+                SEND_QUEUE_OVERFLOWS, upper=True
+            ),
+            cv.Optional(CONF_LIST_ENTITIES_CACHE, default=False): cv.boolean,
             cv.Exclusive(
                 CONF_SERVICES, group_of_exclusion=CONF_ACTIONS
             ): ACTIONS_SCHEMA,
@@ -120,6 +137,11 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    cg.add(var.set_send_queue_limit(config[CONF_SEND_QUEUE_LIMIT]))
+    cg.add(var.set_send_queue_overflow(config[CONF_SEND_QUEUE_OVERFLOW]))
+    if config[CONF_LIST_ENTITIES_CACHE]:
+        cg.add_define("USE_API_LIST_ENTITIES_CACHE")
 
     for conf in config.get(CONF_ACTIONS, []):
         template_args = []
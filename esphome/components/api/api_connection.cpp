@@ -21,12 +21,23 @@
 #ifdef USE_VOICE_ASSISTANT
 #include "esphome/components/voice_assistant/voice_assistant.h"
 #endif
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
 
 namespace esphome {
 namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+// Encoded size at which a batch of state updates is written, about the payload of one TCP segment
+static const size_t MAX_BATCH_SIZE = 1360;
+// Messages handled per loop iteration at most, so that a flood of requests doesn't block the main loop
+static const uint8_t MAX_MESSAGES_PER_LOOP = 8;
+#ifdef USE_API_LIST_ENTITIES_CACHE
+// Entities encoded per loop iteration while building the list entities cache
+static const uint8_t LIST_ENTITIES_CACHE_BUILD_PER_LOOP = 16;
+#endif
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
@@ -39,6 +50,7 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #else
 #error "No frame helper defined"
 #endif
+  this->helper_->get_tx_queue().set_limit(parent->get_send_queue_limit());
 }
 void APIConnection::start() {
   this->last_traffic_ = millis();
@@ -93,30 +105,41 @@ void APIConnection::loop() {
              api_error_to_str(err), errno);
     return;
   }
-  ReadPacketBuffer buffer;
-  err = this->helper_->read_packet(&buffer);
-  if (err == APIError::WOULD_BLOCK) {
-    // pass
-  } else if (err != APIError::OK) {
-    on_fatal_error();
-    if (err == APIError::SOCKET_READ_FAILED && errno == ECONNRESET) {
-      ESP_LOGW(TAG, "%s: Connection reset", this->client_combined_info_.c_str());
-    } else if (err == APIError::CONNECTION_CLOSED) {
-      ESP_LOGW(TAG, "%s: Connection closed", this->client_combined_info_.c_str());
+  // Handle the messages that arrived together, they are parsed from the frame helper's buffer without further reads.
+  // Nothing arrived since the last iteration if the socket isn't ready, then the read is skipped.
+  for (uint8_t message_count = 0; message_count < MAX_MESSAGES_PER_LOOP && this->helper_->is_socket_ready();
+       message_count++) {
+    ReadPacketBuffer buffer;
+    err = this->helper_->read_packet(&buffer);
+    if (err == APIError::WOULD_BLOCK) {
+      break;
+    } else if (err != APIError::OK) {
+      on_fatal_error();
+      if (err == APIError::SOCKET_READ_FAILED && errno == ECONNRESET) {
+        ESP_LOGW(TAG, "%s: Connection reset", this->client_combined_info_.c_str());
+      } else if (err == APIError::CONNECTION_CLOSED) {
+        ESP_LOGW(TAG, "%s: Connection closed", this->client_combined_info_.c_str());
+      } else {
+        ESP_LOGW(TAG, "%s: Reading failed: %s errno=%d", this->client_combined_info_.c_str(), api_error_to_str(err),
+                 errno);
+      }
+      return;
     } else {
-      ESP_LOGW(TAG, "%s: Reading failed: %s errno=%d", this->client_combined_info_.c_str(), api_error_to_str(err),
-               errno);
+      this->last_traffic_ = millis();
+      // read a packet
+      this->read_message(buffer.data_len, buffer.type, buffer.data);
+      if (this->remove_)
+        return;
     }
-    return;
-  } else {
-    this->last_traffic_ = millis();
-    // read a packet
-    this->read_message(buffer.data_len, buffer.type, &buffer.container[buffer.data_offset]);
-    if (this->remove_)
-      return;
   }
 
   this->list_entities_iterator_.advance();
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  if (!this->list_entities_cache_builder_.completed())
+    this->build_list_entities_cache_();
+  if (this->list_entities_cache_at_ >= 0)
+    this->send_list_entities_cache_();
+#endif
   this->initial_state_iterator_.advance();
 
   static uint32_t keepalive = 60000;
@@ -152,14 +175,20 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    const uint32_t key = esp32_camera::global_esp32_camera->get_object_id_hash();
+    bool done = this->image_reader_.available() == to_send;
+    uint32_t msg_size = 0;
+    ProtoSize::add_fixed32(msg_size, 1, key);
+    ProtoSize::add_length(msg_size, 2, to_send);
+    ProtoSize::add_bool(msg_size, 3, done);
+    auto buffer = this->create_buffer(msg_size);
     // fixed32 key = 1;
-    buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
+    buffer.encode_fixed32(1, key);
     // bytes data = 2;
     buffer.encode_bytes(2, this->image_reader_.peek_data_buffer(), to_send);
     // bool done = 3;
-    bool done = this->image_reader_.available() == to_send;
     buffer.encode_bool(3, done);
+    buffer.check_end();
     bool success = this->send_buffer(buffer, 44);
 
     if (success) {
@@ -187,6 +216,12 @@ void APIConnection::loop() {
     }
   }
 }
+void APIConnection::flush_due_state_updates() {
+  if (this->remove_ || this->pending_state_updates_.empty())
+    return;
+  if (millis() - this->pending_state_updates_since_ >= this->parent_->get_batch_delay())
+    this->flush_state_updates_();
+}
 
 std::string get_default_unique_id(const std::string &component_type, EntityBase *entity) {
   return App.get_name() + component_type + entity->get_object_id();
@@ -207,12 +242,13 @@ void APIConnection::on_disconnect_response(const DisconnectResponse &value) {
 
 #ifdef USE_BINARY_SENSOR
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(binary_sensor, &APIConnection::try_send_binary_sensor_state_);
+}
+bool APIConnection::try_send_binary_sensor_state_(EntityBase *entity) {
+  auto *binary_sensor = static_cast<binary_sensor::BinarySensor *>(entity);
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
-  resp.state = state;
+  resp.state = binary_sensor->state;
   resp.missing_state = !binary_sensor->has_state();
   return this->send_binary_sensor_state_response(resp);
 }
@@ -234,9 +270,10 @@ bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_
 
 #ifdef USE_COVER
 bool APIConnection::send_cover_state(cover::Cover *cover) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(cover, &APIConnection::try_send_cover_state_);
+}
+bool APIConnection::try_send_cover_state_(EntityBase *entity) {
+  auto *cover = static_cast<cover::Cover *>(entity);
   auto traits = cover->get_traits();
   CoverStateResponse resp{};
   resp.key = cover->get_object_id_hash();
@@ -297,9 +334,10 @@ void APIConnection::cover_command(const CoverCommandRequest &msg) {
 
 #ifdef USE_FAN
 bool APIConnection::send_fan_state(fan::Fan *fan) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(fan, &APIConnection::try_send_fan_state_);
+}
+bool APIConnection::try_send_fan_state_(EntityBase *entity) {
+  auto *fan = static_cast<fan::Fan *>(entity);
   auto traits = fan->get_traits();
   FanStateResponse resp{};
   resp.key = fan->get_object_id_hash();
@@ -358,9 +396,10 @@ void APIConnection::fan_command(const FanCommandRequest &msg) {
 
 #ifdef USE_LIGHT
 bool APIConnection::send_light_state(light::LightState *light) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(light, &APIConnection::try_send_light_state_);
+}
+bool APIConnection::try_send_light_state_(EntityBase *entity) {
+  auto *light = static_cast<light::LightState *>(entity);
   auto traits = light->get_traits();
   auto values = light->remote_values;
   auto color_mode = values.get_color_mode();
@@ -456,12 +495,13 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
 
 #ifdef USE_SENSOR
 bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(sensor, &APIConnection::try_send_sensor_state_);
+}
+bool APIConnection::try_send_sensor_state_(EntityBase *entity) {
+  auto *sensor = static_cast<sensor::Sensor *>(entity);
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
-  resp.state = state;
+  resp.state = sensor->state;
   resp.missing_state = !sensor->has_state();
   return this->send_sensor_state_response(resp);
 }
@@ -488,12 +528,13 @@ bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
 
 #ifdef USE_SWITCH
 bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(a_switch, &APIConnection::try_send_switch_state_);
+}
+bool APIConnection::try_send_switch_state_(EntityBase *entity) {
+  auto *a_switch = static_cast<switch_::Switch *>(entity);
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
-  resp.state = state;
+  resp.state = a_switch->state;
   return this->send_switch_state_response(resp);
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
@@ -525,12 +566,13 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 
 #ifdef USE_TEXT_SENSOR
 bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(text_sensor, &APIConnection::try_send_text_sensor_state_);
+}
+bool APIConnection::try_send_text_sensor_state_(EntityBase *entity) {
+  auto *text_sensor = static_cast<text_sensor::TextSensor *>(entity);
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = text_sensor->state;
   resp.missing_state = !text_sensor->has_state();
   return this->send_text_sensor_state_response(resp);
 }
@@ -552,9 +594,10 @@ bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor)
 
 #ifdef USE_CLIMATE
 bool APIConnection::send_climate_state(climate::Climate *climate) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(climate, &APIConnection::try_send_climate_state_);
+}
+bool APIConnection::try_send_climate_state_(EntityBase *entity) {
+  auto *climate = static_cast<climate::Climate *>(entity);
   auto traits = climate->get_traits();
   ClimateStateResponse resp{};
   resp.key = climate->get_object_id_hash();
@@ -660,12 +703,13 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 
 #ifdef USE_NUMBER
 bool APIConnection::send_number_state(number::Number *number, float state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(number, &APIConnection::try_send_number_state_);
+}
+bool APIConnection::try_send_number_state_(EntityBase *entity) {
+  auto *number = static_cast<number::Number *>(entity);
   NumberStateResponse resp{};
   resp.key = number->get_object_id_hash();
-  resp.state = state;
+  resp.state = number->state;
   resp.missing_state = !number->has_state();
   return this->send_number_state_response(resp);
 }
@@ -702,9 +746,10 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 
 #ifdef USE_DATETIME_DATE
 bool APIConnection::send_date_state(datetime::DateEntity *date) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(date, &APIConnection::try_send_date_state_);
+}
+bool APIConnection::try_send_date_state_(EntityBase *entity) {
+  auto *date = static_cast<datetime::DateEntity *>(entity);
   DateStateResponse resp{};
   resp.key = date->get_object_id_hash();
   resp.missing_state = !date->has_state();
@@ -739,9 +784,10 @@ void APIConnection::date_command(const DateCommandRequest &msg) {
 
 #ifdef USE_DATETIME_TIME
 bool APIConnection::send_time_state(datetime::TimeEntity *time) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(time, &APIConnection::try_send_time_state_);
+}
+bool APIConnection::try_send_time_state_(EntityBase *entity) {
+  auto *time = static_cast<datetime::TimeEntity *>(entity);
   TimeStateResponse resp{};
   resp.key = time->get_object_id_hash();
   resp.missing_state = !time->has_state();
@@ -776,9 +822,10 @@ void APIConnection::time_command(const TimeCommandRequest &msg) {
 
 #ifdef USE_DATETIME_DATETIME
 bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(datetime, &APIConnection::try_send_datetime_state_);
+}
+bool APIConnection::try_send_datetime_state_(EntityBase *entity) {
+  auto *datetime = static_cast<datetime::DateTimeEntity *>(entity);
   DateTimeStateResponse resp{};
   resp.key = datetime->get_object_id_hash();
   resp.missing_state = !datetime->has_state();
@@ -814,12 +861,13 @@ void APIConnection::datetime_command(const DateTimeCommandRequest &msg) {
 
 #ifdef USE_TEXT
 bool APIConnection::send_text_state(text::Text *text, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(text, &APIConnection::try_send_text_state_);
+}
+bool APIConnection::try_send_text_state_(EntityBase *entity) {
+  auto *text = static_cast<text::Text *>(entity);
   TextStateResponse resp{};
   resp.key = text->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = text->state;
   resp.missing_state = !text->has_state();
   return this->send_text_state_response(resp);
 }
@@ -852,12 +900,13 @@ void APIConnection::text_command(const TextCommandRequest &msg) {
 
 #ifdef USE_SELECT
 bool APIConnection::send_select_state(select::Select *select, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(select, &APIConnection::try_send_select_state_);
+}
+bool APIConnection::try_send_select_state_(EntityBase *entity) {
+  auto *select = static_cast<select::Select *>(entity);
   SelectStateResponse resp{};
   resp.key = select->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = select->state;
   resp.missing_state = !select->has_state();
   return this->send_select_state_response(resp);
 }
@@ -913,12 +962,13 @@ void APIConnection::button_command(const ButtonCommandRequest &msg) {
 
 #ifdef USE_LOCK
 bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(a_lock, &APIConnection::try_send_lock_state_);
+}
+bool APIConnection::try_send_lock_state_(EntityBase *entity) {
+  auto *a_lock = static_cast<lock::Lock *>(entity);
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
-  resp.state = static_cast<enums::LockState>(state);
+  resp.state = static_cast<enums::LockState>(a_lock->state);
   return this->send_lock_state_response(resp);
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
@@ -957,9 +1007,10 @@ void APIConnection::lock_command(const LockCommandRequest &msg) {
 
 #ifdef USE_VALVE
 bool APIConnection::send_valve_state(valve::Valve *valve) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(valve, &APIConnection::try_send_valve_state_);
+}
+bool APIConnection::try_send_valve_state_(EntityBase *entity) {
+  auto *valve = static_cast<valve::Valve *>(entity);
   ValveStateResponse resp{};
   resp.key = valve->get_object_id_hash();
   resp.position = valve->position;
@@ -999,9 +1050,10 @@ void APIConnection::valve_command(const ValveCommandRequest &msg) {
 
 #ifdef USE_MEDIA_PLAYER
 bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(media_player, &APIConnection::try_send_media_player_state_);
+}
+bool APIConnection::try_send_media_player_state_(EntityBase *entity) {
+  auto *media_player = static_cast<media_player::MediaPlayer *>(entity);
   MediaPlayerStateResponse resp{};
   resp.key = media_player->get_object_id_hash();
 
@@ -1265,9 +1317,10 @@ void APIConnection::voice_assistant_set_configuration(const VoiceAssistantSetCon
 
 #ifdef USE_ALARM_CONTROL_PANEL
 bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(a_alarm_control_panel, &APIConnection::try_send_alarm_control_panel_state_);
+}
+bool APIConnection::try_send_alarm_control_panel_state_(EntityBase *entity) {
+  auto *a_alarm_control_panel = static_cast<alarm_control_panel::AlarmControlPanel *>(entity);
   AlarmControlPanelStateResponse resp{};
   resp.key = a_alarm_control_panel->get_object_id_hash();
   resp.state = static_cast<enums::AlarmControlPanelState>(a_alarm_control_panel->get_state());
@@ -1347,9 +1400,10 @@ bool APIConnection::send_event_info(event::Event *event) {
 
 #ifdef USE_UPDATE
 bool APIConnection::send_update_state(update::UpdateEntity *update) {
-  if (!this->state_subscription_)
-    return false;
-
+  return this->schedule_state_update_(update, &APIConnection::try_send_update_state_);
+}
+bool APIConnection::try_send_update_state_(EntityBase *entity) {
+  auto *update = static_cast<update::UpdateEntity *>(entity);
   UpdateStateResponse resp{};
   resp.key = update->get_object_id_hash();
   resp.missing_state = !update->has_state();
@@ -1403,16 +1457,64 @@ void APIConnection::update_command(const UpdateCommandRequest &msg) {
 }
 #endif
 
+#ifdef USE_PROFILER
+GetProfileResponse APIConnection::get_profile(const GetProfileRequest &msg) {
+  GetProfileResponse resp;
+  profiler::Profiler *profiler = profiler::global_profiler;
+  if (profiler == nullptr)
+    return resp;
+
+  resp.window_ms = profiler->get_window_ms();
+  resp.loop_time_max_us = profiler->get_loop_time().max_us;
+  resp.loop_time_p99_us = profiler->get_loop_time().p99_us;
+  resp.loop_jitter_max_us = profiler->get_loop_jitter().max_us;
+  resp.loop_jitter_p99_us = profiler->get_loop_jitter().p99_us;
+  resp.components.reserve(profiler->get_components().size());
+  for (auto *profile : profiler->get_components()) {
+    ProfileComponentStats stats;
+    stats.source = profile->get_source();
+    stats.loop_count = profile->last_loop.count;
+    stats.loop_total_us = profile->last_loop.total_us;
+    stats.loop_max_us = profile->last_loop.max_us;
+    stats.loop_p99_us = profile->last_loop.p99_us;
+    stats.scheduler_count = profile->last_scheduler.count;
+    stats.scheduler_total_us = profile->last_scheduler.total_us;
+    stats.scheduler_max_us = profile->last_scheduler.max_us;
+    stats.scheduler_p99_us = profile->last_scheduler.p99_us;
+    resp.components.push_back(std::move(stats));
+  }
+  return resp;
+}
+#endif
+
+ConnectionStatsResponse APIConnection::connection_stats(const ConnectionStatsRequest &msg) {
+  ConnectionStatsResponse resp;
+  const APIFrameTxQueue &tx_queue = this->helper_->get_tx_queue();
+  resp.send_queue_bytes = tx_queue.size();
+  resp.send_queue_peak_bytes = tx_queue.get_peak_size();
+  resp.send_queue_limit = tx_queue.get_limit();
+  resp.messages_dropped = tx_queue.get_dropped_messages();
+  resp.bytes_dropped = tx_queue.get_dropped_bytes();
+  resp.state_updates_coalesced = this->state_updates_coalesced_;
+  resp.state_updates_flushed = this->state_updates_flushed_;
+  return resp;
+}
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_len = strlen(line);
+  uint32_t msg_size = 0;
+  ProtoSize::add_uint32(msg_size, 1, static_cast<uint32_t>(level));
+  ProtoSize::add_length(msg_size, 3, line_len);
+  auto buffer = this->create_buffer(msg_size);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_len);
+  buffer.check_end();
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -1516,9 +1618,175 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
+void APIConnection::list_entities(const ListEntitiesRequest &msg) {
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  if (!this->parent_->get_list_entities_cache().is_valid()) {
+    this->begin_list_entities_cache_();
+    return;
+  }
+  this->list_entities_cache_at_ = 0;
+  this->send_list_entities_cache_();
+#else
+  this->list_entities_iterator_.begin();
+#endif
+}
+#ifdef USE_API_LIST_ENTITIES_CACHE
+void APIConnection::begin_list_entities_cache_() {
+  this->list_entities_cache_at_ = -1;
+  this->list_entities_cache_data_.clear();
+  this->list_entities_cache_packets_.clear();
+  this->list_entities_cache_generation_ = this->parent_->get_list_entities_cache().get_generation();
+  this->list_entities_cache_builder_.begin();
+}
+void APIConnection::build_list_entities_cache_() {
+  ListEntitiesCache &cache = this->parent_->get_list_entities_cache();
+  if (cache.get_generation() != this->list_entities_cache_generation_) {
+    // The metadata changed since encoding started, start over in the next iteration
+    this->begin_list_entities_cache_();
+    return;
+  }
+  // The messages are encoded as a batch into their own buffers, which are swapped in for as long as this takes
+  std::swap(this->proto_write_buffer_, this->list_entities_cache_data_);
+  std::swap(this->batch_packets_, this->list_entities_cache_packets_);
+  this->batching_messages_ = true;
+  for (uint8_t i = 0; i < LIST_ENTITIES_CACHE_BUILD_PER_LOOP && !this->list_entities_cache_builder_.completed(); i++)
+    this->list_entities_cache_builder_.advance();
+  this->batching_messages_ = false;
+  std::swap(this->proto_write_buffer_, this->list_entities_cache_data_);
+  std::swap(this->batch_packets_, this->list_entities_cache_packets_);
+  if (!this->list_entities_cache_builder_.completed())
+    return;
+
+  cache.set(std::move(this->list_entities_cache_data_), std::move(this->list_entities_cache_packets_));
+  ESP_LOGD(TAG, "Cached %u entity list messages (%u bytes)", (unsigned) cache.get_packets().size(),
+           (unsigned) cache.get_data().size());
+  this->list_entities_cache_at_ = 0;
+  this->send_list_entities_cache_();
+}
+void APIConnection::send_list_entities_cache_() {
+  const ListEntitiesCache &cache = this->parent_->get_list_entities_cache();
+  if (!cache.is_valid()) {
+    // Invalidated while listing, start over with the current metadata
+    this->begin_list_entities_cache_();
+    return;
+  }
+  const std::vector<PacketInfo> &packets = cache.get_packets();
+  const APIFrameTxQueue &tx_queue = this->helper_->get_tx_queue();
+  size_t at = this->list_entities_cache_at_;
+  // Only write while the socket takes everything, the cached messages are never copied into the send queue in bulk
+  while (at < packets.size() && tx_queue.empty() && this->helper_->can_write_without_blocking()) {
+    size_t count = 0;
+    uint32_t len = 0;
+    while (at + count < packets.size() && (count == 0 || len + packets[at + count].len <= MAX_BATCH_SIZE)) {
+      len += packets[at + count].len;
+      count++;
+    }
+    APIError err = this->helper_->write_packets(cache.get_data().data(), &packets[at], count);
+    if (!this->handle_write_error_(err))
+      return;
+    at += count;
+  }
+  this->list_entities_cache_at_ = at < packets.size() ? static_cast<int>(at) : -1;
+}
+#endif
+bool APIConnection::schedule_state_update_(EntityBase *entity, state_sender_t sender) {
+  if (!this->state_subscription_ || this->remove_)
+    return false;
+
+  if (!this->pending_state_entities_.insert(entity).second) {
+    this->state_updates_coalesced_++;
+    return true;
+  }
+  if (this->pending_state_updates_.empty())
+    this->pending_state_updates_since_ = millis();
+  this->pending_state_updates_.push_back({entity, sender});
+  return true;
+}
+void APIConnection::flush_state_updates_() {
+  if (this->remove_)
+    return;
+  if (!this->helper_->can_write_without_blocking()) {
+    // Keep the updates queued, they are sent once the socket has drained and may be coalesced further meanwhile
+    return;
+  }
+
+  // With several connections the messages are encoded into the shared cache instead, the updates already encoded by
+  // another connection are then written from there without encoding them again
+  EncodedStateCache *cache = this->parent_->get_encoded_state_cache();
+  if (cache != nullptr) {
+    std::swap(this->proto_write_buffer_, cache->get_buffer());
+  } else {
+    this->proto_write_buffer_.clear();
+  }
+  this->batch_packets_.clear();
+  this->batching_messages_ = true;
+  // Updates before this index have been written
+  size_t written = 0;
+  uint32_t batch_size = 0;
+  bool ok = true;
+  for (size_t i = 0; i < this->pending_state_updates_.size(); i++) {
+    auto &update = this->pending_state_updates_[i];
+    const size_t count = this->batch_packets_.size();
+    const PacketInfo *encoded = cache != nullptr ? cache->find(update.entity, i) : nullptr;
+    if (encoded != nullptr) {
+      this->batch_packets_.push_back(*encoded);
+    } else {
+      (this->*update.sender)(update.entity);
+      if (cache != nullptr && this->batch_packets_.size() == count + 1)
+        cache->add(update.entity, i, this->batch_packets_.back());
+    }
+    if (this->batch_packets_.size() != count)
+      batch_size += this->batch_packets_.back().len;
+    // Bound the size of the writes, a large batch is written in parts
+    if (batch_size >= MAX_BATCH_SIZE) {
+      ok = this->write_batch_();
+      if (!ok)
+        break;
+      written = i + 1;
+      batch_size = 0;
+      if (cache == nullptr)
+        this->proto_write_buffer_.clear();
+    }
+  }
+  this->batching_messages_ = false;
+  if (ok && this->write_batch_())
+    written = this->pending_state_updates_.size();
+  if (cache != nullptr) {
+    std::swap(this->proto_write_buffer_, cache->get_buffer());
+  } else {
+    this->proto_write_buffer_.clear();
+  }
+  // Updates the send queue had no room for stay queued, they are encoded again from the current state next time
+  this->batch_packets_.clear();
+  if (written == this->pending_state_updates_.size()) {
+    this->pending_state_entities_.clear();
+  } else {
+    for (size_t i = 0; i < written; i++)
+      this->pending_state_entities_.erase(this->pending_state_updates_[i].entity);
+  }
+  this->pending_state_updates_.erase(this->pending_state_updates_.begin(),
+                                     this->pending_state_updates_.begin() + written);
+}
+bool APIConnection::write_batch_() {
+  if (this->batch_packets_.empty() || this->remove_)
+    return !this->remove_;
+
+  APIError err = this->helper_->write_packets(this->proto_write_buffer_.data(), this->batch_packets_.data(),
+                                              this->batch_packets_.size());
+  if (err == APIError::OK)
+    this->state_updates_flushed_ += this->batch_packets_.size();
+  this->batch_packets_.clear();
+  return this->handle_write_error_(err);
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
   if (this->remove_)
     return false;
+  if (this->batching_messages_) {
+    const uint32_t end = this->proto_write_buffer_.size();
+    this->batch_packets_.push_back(
+        {static_cast<uint16_t>(message_type), this->batch_message_start_, end - this->batch_message_start_});
+    return true;
+  }
   if (!this->helper_->can_write_without_blocking()) {
     delay(0);
     APIError err = this->helper_->loop();
@@ -1528,7 +1796,8 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
                api_error_to_str(err), errno);
       return false;
     }
-    if (!this->helper_->can_write_without_blocking()) {
+    // A full send queue is left to write_packet(), which counts the dropped message and applies the overflow policy
+    if (!this->helper_->can_write_without_blocking() && this->helper_->get_tx_queue().has_room()) {
       // SubscribeLogsResponse
       if (message_type != 29) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
@@ -1538,9 +1807,21 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  APIError err =
+      this->helper_->write_packet(message_type, this->proto_write_buffer_.data(), this->proto_write_buffer_.size());
+  return this->handle_write_error_(err);
+}
+bool APIConnection::handle_write_error_(APIError err) {
   if (err == APIError::WOULD_BLOCK)
     return false;
+  if (err == APIError::SEND_QUEUE_FULL) {
+    // Dropped messages are only counted, logging them could queue another log message
+    if (this->parent_->get_send_queue_overflow() == SEND_QUEUE_OVERFLOW_DISCONNECT) {
+      on_fatal_error();
+      ESP_LOGW(TAG, "%s: Send queue full, disconnecting", this->client_combined_info_.c_str());
+    }
+    return false;
+  }
   if (err != APIError::OK) {
     on_fatal_error();
     if (err == APIError::SOCKET_WRITE_FAILED && errno == ECONNRESET) {
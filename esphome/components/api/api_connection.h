@@ -9,6 +9,7 @@
 #include "esphome/core/application.h"
 #include "esphome/core/component.h"
 
+#include <unordered_set>
 #include <vector>
 
 namespace esphome {
@@ -21,6 +22,8 @@ class APIConnection : public APIServerConnection {
 
   void start();
   void loop();
+  /// Send the queued state updates if the batch delay has passed, see APIServer::loop().
+  void flush_due_state_updates();
 
   bool send_list_info_done() {
     ListEntitiesDoneResponse resp;
@@ -175,6 +178,11 @@ class APIConnection : public APIServerConnection {
   void update_command(const UpdateCommandRequest &msg) override;
 #endif
 
+#ifdef USE_PROFILER
+  GetProfileResponse get_profile(const GetProfileRequest &msg) override;
+#endif
+  ConnectionStatsResponse connection_stats(const ConnectionStatsRequest &msg) override;
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
@@ -190,7 +198,7 @@ class APIConnection : public APIServerConnection {
   DisconnectResponse disconnect(const DisconnectRequest &msg) override;
   PingResponse ping(const PingRequest &msg) override { return {}; }
   DeviceInfoResponse device_info(const DeviceInfoRequest &msg) override;
-  void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
+  void list_entities(const ListEntitiesRequest &msg) override;
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->state_subscription_ = true;
     this->initial_state_iterator_.begin();
@@ -217,10 +225,18 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t size) override {
     // FIXME: ensure no recursive writes can happen
-    this->proto_write_buffer_.clear();
-    return {&this->proto_write_buffer_};
+    if (this->batching_messages_) {
+      // The messages of a batch are encoded one after another into the same buffer
+      this->batch_message_start_ = this->proto_write_buffer_.size();
+    } else {
+      this->proto_write_buffer_.clear();
+    }
+    // Size the buffer for the whole message once, the buffer then writes into it unchecked
+    const size_t start = this->proto_write_buffer_.size();
+    this->proto_write_buffer_.resize(start + size);
+    return ProtoWriteBuffer(this->proto_write_buffer_.data() + start, size);
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
 
@@ -231,6 +247,85 @@ class APIConnection : public APIServerConnection {
 
   bool send_(const void *buf, size_t len, bool force);
 
+  /// Encodes and sends the current state of an entity, see schedule_state_update_().
+  using state_sender_t = bool (APIConnection::*)(EntityBase *entity);
+  /** Queue a state update, to be sent together with the other updates queued until the next flush.
+   *
+   * An entity has at most one queued update: its state is only read when the batch is sent, so a later update of
+   * the same entity is already covered by the queued one.
+   */
+  bool schedule_state_update_(EntityBase *entity, state_sender_t sender);
+  /// Send all queued state updates as one batch, in a single socket write.
+  void flush_state_updates_();
+  /// Write the state updates batched so far, false if the connection failed. Keeps proto_write_buffer_.
+  bool write_batch_();
+  bool handle_write_error_(APIError err);
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  /// Start encoding the ListEntities responses of all entities for the cache, as the iterator would send them.
+  void begin_list_entities_cache_();
+  /// Encode the next few entities for the cache, then store it and start sending it once all are encoded.
+  void build_list_entities_cache_();
+  /// Write the cached ListEntities responses for as long as the socket accepts them.
+  void send_list_entities_cache_();
+#endif
+#ifdef USE_BINARY_SENSOR
+  bool try_send_binary_sensor_state_(EntityBase *entity);
+#endif
+#ifdef USE_COVER
+  bool try_send_cover_state_(EntityBase *entity);
+#endif
+#ifdef USE_FAN
+  bool try_send_fan_state_(EntityBase *entity);
+#endif
+#ifdef USE_LIGHT
+  bool try_send_light_state_(EntityBase *entity);
+#endif
+#ifdef USE_SENSOR
+  bool try_send_sensor_state_(EntityBase *entity);
+#endif
+#ifdef USE_SWITCH
+  bool try_send_switch_state_(EntityBase *entity);
+#endif
+#ifdef USE_TEXT_SENSOR
+  bool try_send_text_sensor_state_(EntityBase *entity);
+#endif
+#ifdef USE_CLIMATE
+  bool try_send_climate_state_(EntityBase *entity);
+#endif
+#ifdef USE_NUMBER
+  bool try_send_number_state_(EntityBase *entity);
+#endif
+#ifdef USE_DATETIME_DATE
+  bool try_send_date_state_(EntityBase *entity);
+#endif
+#ifdef USE_DATETIME_TIME
+  bool try_send_time_state_(EntityBase *entity);
+#endif
+#ifdef USE_DATETIME_DATETIME
+  bool try_send_datetime_state_(EntityBase *entity);
+#endif
+#ifdef USE_TEXT
+  bool try_send_text_state_(EntityBase *entity);
+#endif
+#ifdef USE_SELECT
+  bool try_send_select_state_(EntityBase *entity);
+#endif
+#ifdef USE_LOCK
+  bool try_send_lock_state_(EntityBase *entity);
+#endif
+#ifdef USE_VALVE
+  bool try_send_valve_state_(EntityBase *entity);
+#endif
+#ifdef USE_MEDIA_PLAYER
+  bool try_send_media_player_state_(EntityBase *entity);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  bool try_send_alarm_control_panel_state_(EntityBase *entity);
+#endif
+#ifdef USE_UPDATE
+  bool try_send_update_state_(EntityBase *entity);
+#endif
+
   enum class ConnectionState {
     WAITING_FOR_HELLO,
     CONNECTED,
@@ -265,6 +360,36 @@ class APIConnection : public APIServerConnection {
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
   int state_subs_at_ = -1;
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  /// Index of the next message of the list entities cache to send, -1 if not listing from the cache.
+  int list_entities_cache_at_ = -1;
+  /// Encodes the entities for the cache, a few per loop iteration so that large nodes don't block the main loop.
+  ListEntitiesIterator list_entities_cache_builder_{this};
+  /// The messages encoded by list_entities_cache_builder_ so far.
+  std::vector<uint8_t> list_entities_cache_data_;
+  std::vector<PacketInfo> list_entities_cache_packets_;
+  /// Generation of the cache when encoding started, encoding starts over if the cache was invalidated meanwhile.
+  uint32_t list_entities_cache_generation_{0};
+#endif
+
+  struct PendingStateUpdate {
+    EntityBase *entity;
+    state_sender_t sender;
+  };
+  /// Queued state updates, in the order they were first queued.
+  std::vector<PendingStateUpdate> pending_state_updates_;
+  /// The entities in pending_state_updates_, to find an update that is already queued without a scan.
+  std::unordered_set<EntityBase *> pending_state_entities_;
+  /// Location of the messages encoded into proto_write_buffer_ while batching_messages_ is set.
+  std::vector<PacketInfo> batch_packets_;
+  uint32_t batch_message_start_{0};
+  uint32_t pending_state_updates_since_{0};
+  /// Whether send_buffer() adds the messages to the batch in proto_write_buffer_ instead of writing them.
+  bool batching_messages_{false};
+  /// Number of state updates that were merged into an already queued update of the same entity.
+  uint32_t state_updates_coalesced_{0};
+  /// Number of state update messages sent in batches.
+  uint32_t state_updates_flushed_{0};
 };
 
 }  // namespace api
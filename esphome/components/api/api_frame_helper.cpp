@@ -5,6 +5,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "proto.h"
+#include <algorithm>
 #include <cstring>
 
 namespace esphome {
@@ -68,6 +69,8 @@ const char *api_error_to_str(APIError err) {
     return "BAD_HANDSHAKE_ERROR_BYTE";
   } else if (err == APIError::CONNECTION_CLOSED) {
     return "CONNECTION_CLOSED";
+  } else if (err == APIError::SEND_QUEUE_FULL) {
+    return "SEND_QUEUE_FULL";
   }
   return "UNKNOWN";
 }
@@ -76,6 +79,118 @@ const char *api_error_to_str(APIError err) {
 // uncomment to log raw packets
 //#define HELPER_LOG_PACKETS
 
+/// Size of the receive buffer, it only grows beyond this for larger frames and shrinks back once they are consumed.
+static const size_t RX_BUF_SIZE = 512;
+
+size_t APIFrameRxBuffer::prepare(size_t needed) {
+  const size_t pending = this->end_ - this->start_;
+  if (pending == 0 && this->buf_.size() > RX_BUF_SIZE && needed <= RX_BUF_SIZE) {
+    // Release the memory of a large frame
+    this->buf_.resize(RX_BUF_SIZE);
+    this->buf_.shrink_to_fit();
+  }
+  if (this->start_ != 0) {
+    // Move the partial frame to the front, everything before it has been consumed
+    memmove(this->buf_.data(), this->buf_.data() + this->start_, pending);
+    this->start_ = 0;
+    this->end_ = pending;
+  }
+  const size_t size = std::max(std::max(needed, pending + 1), RX_BUF_SIZE);
+  if (this->buf_.size() < size)
+    this->buf_.resize(size);
+  return this->buf_.size() - this->end_;
+}
+
+/// Number of sent segments kept for reuse per send queue.
+static const size_t TX_POOL_SIZE = 2;
+/// Maximum number of segments written with one writev() call.
+static const int TX_MAX_IOV = 8;
+
+uint8_t *APIFrameTxQueue::reserve(size_t len) {
+  if (!this->segments_.empty()) {
+    Segment &tail = this->segments_.back();
+    if (tail.capacity - tail.end >= len)
+      return tail.data.get() + tail.end;
+  }
+  Segment segment{};
+  if (len > SEGMENT_SIZE) {
+    segment.data.reset(new uint8_t[len]);  // NOLINT(cppcoreguidelines-owning-memory)
+    segment.capacity = len;
+  } else {
+    if (this->pool_.empty()) {
+      segment.data.reset(new uint8_t[SEGMENT_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+    } else {
+      segment.data = std::move(this->pool_.back());
+      this->pool_.pop_back();
+    }
+    segment.capacity = SEGMENT_SIZE;
+  }
+  this->segments_.push_back(std::move(segment));
+  return this->segments_.back().data.get();
+}
+void APIFrameTxQueue::commit(size_t len) {
+  this->segments_.back().end += len;
+  this->size_ += len;
+  this->peak_size_ = std::max(this->peak_size_, this->size_);
+}
+void APIFrameTxQueue::append(const struct iovec *iov, int iovcnt) {
+  for (int i = 0; i < iovcnt; i++) {
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(iov[i].iov_base);
+    size_t remaining = iov[i].iov_len;
+    while (remaining != 0) {
+      // Fill up the tail segment first, raw data doesn't have to be contiguous
+      size_t chunk = 0;
+      if (!this->segments_.empty())
+        chunk = std::min(remaining, this->segments_.back().capacity - this->segments_.back().end);
+      if (chunk == 0)
+        chunk = std::min(remaining, SEGMENT_SIZE);
+      memcpy(this->reserve(chunk), data, chunk);
+      this->commit(chunk);
+      data += chunk;
+      remaining -= chunk;
+    }
+  }
+}
+int APIFrameTxQueue::fill_iov(struct iovec *iov, int max_iov) const {
+  int count = 0;
+  for (const Segment &segment : this->segments_) {
+    if (count == max_iov)
+      break;
+    if (segment.end == segment.start)
+      continue;
+    iov[count].iov_base = segment.data.get() + segment.start;
+    iov[count].iov_len = segment.end - segment.start;
+    count++;
+  }
+  return count;
+}
+void APIFrameTxQueue::consume(size_t len) {
+  this->size_ -= len;
+  while (len != 0) {
+    Segment &head = this->segments_.front();
+    size_t chunk = std::min(len, head.end - head.start);
+    head.start += chunk;
+    len -= chunk;
+    if (head.start == head.end && (len != 0 || this->segments_.size() > 1 || head.capacity != SEGMENT_SIZE)) {
+      if (head.capacity == SEGMENT_SIZE && this->pool_.size() < TX_POOL_SIZE)
+        this->pool_.push_back(std::move(head.data));
+      this->segments_.pop_front();
+    }
+  }
+  if (this->size_ == 0 && !this->segments_.empty()) {
+    // Keep the last pooled segment in place, but write to it from the start again
+    this->segments_.front().start = 0;
+    this->segments_.front().end = 0;
+  }
+}
+bool APIFrameTxQueue::check_limit(size_t len, size_t messages) {
+  if (this->limit_ == 0 || this->size_ == 0 || this->size_ + len <= this->limit_)
+    return true;
+  this->dropped_messages_ += messages;
+  this->dropped_bytes_ += len;
+  return false;
+}
+
 #ifdef USE_API_NOISE
 static const char *const PROLOGUE_INIT = "NoiseAPIInit";
 
@@ -152,7 +267,7 @@ APIError APINoiseFrameHelper::loop() {
     return APIError::OK;
   if (err != APIError::OK)
     return err;
-  if (!tx_buf_.empty()) {
+  if (!tx_queue_.empty()) {
     err = try_send_tx_buf_();
     if (err != APIError::OK) {
       return err;
@@ -161,13 +276,13 @@ APIError APINoiseFrameHelper::loop() {
   return APIError::OK;
 }
 
-/** Read a packet into the rx_buf_. If successful, stores frame data in the frame parameter
+/** Read a frame into the rx_buf_. If successful, stores frame data in the frame parameter
  *
  * @param frame: The struct to hold the frame information in.
- *   msg_start: points to the start of the payload - this pointer is only valid until the next
- *     try_receive_raw_ call
+ *   msg: points to the start of the frame content in rx_buf_ - this pointer is only valid until the next
+ *     try_read_frame_ call
  *
- * @return 0 if a full packet is in rx_buf_
+ * @return 0 if a full frame is in rx_buf_
  * @return -1 if error, check errno.
  *
  * errno EWOULDBLOCK: Packet could not be read without blocking. Try again later.
@@ -181,58 +296,46 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
     return APIError::BAD_ARG;
   }
 
-  // read header
-  if (rx_header_buf_len_ < 3) {
-    // no header information yet
-    size_t to_read = 3 - rx_header_buf_len_;
-    ssize_t received = socket_->read(&rx_header_buf_[rx_header_buf_len_], to_read);
-    if (received == -1) {
-      if (errno == EWOULDBLOCK || errno == EAGAIN) {
-        return APIError::WOULD_BLOCK;
+  bool socket_drained = false;
+  while (true) {
+    size_t needed = 3;
+    if (rx_buf_.size() >= 3) {
+      // parse header
+      const uint8_t *header = rx_buf_.data();
+      uint8_t indicator = header[0];
+      if (indicator != 0x01) {
+        state_ = State::FAILED;
+        HELPER_LOG("Bad indicator byte %u", indicator);
+        return APIError::BAD_INDICATOR;
       }
-      state_ = State::FAILED;
-      HELPER_LOG("Socket read failed with errno %d", errno);
-      return APIError::SOCKET_READ_FAILED;
-    } else if (received == 0) {
-      state_ = State::FAILED;
-      HELPER_LOG("Connection closed");
-      return APIError::CONNECTION_CLOSED;
-    }
-    rx_header_buf_len_ += received;
-    if ((size_t) received != to_read) {
-      // not a full read
-      return APIError::WOULD_BLOCK;
-    }
-
-    // header reading done
-  }
 
-  // read body
-  uint8_t indicator = rx_header_buf_[0];
-  if (indicator != 0x01) {
-    state_ = State::FAILED;
-    HELPER_LOG("Bad indicator byte %u", indicator);
-    return APIError::BAD_INDICATOR;
-  }
+      uint16_t msg_size = (((uint16_t) header[1]) << 8) | header[2];
 
-  uint16_t msg_size = (((uint16_t) rx_header_buf_[1]) << 8) | rx_header_buf_[2];
-
-  if (state_ != State::DATA && msg_size > 128) {
-    // for handshake message only permit up to 128 bytes
-    state_ = State::FAILED;
-    HELPER_LOG("Bad packet len for handshake: %d", msg_size);
-    return APIError::BAD_HANDSHAKE_PACKET_LEN;
-  }
+      if (state_ != State::DATA && msg_size > 128) {
+        // for handshake message only permit up to 128 bytes
+        state_ = State::FAILED;
+        HELPER_LOG("Bad packet len for handshake: %d", msg_size);
+        return APIError::BAD_HANDSHAKE_PACKET_LEN;
+      }
 
-  // reserve space for body
-  if (rx_buf_.size() != msg_size) {
-    rx_buf_.resize(msg_size);
-  }
+      needed += msg_size;
+      if (rx_buf_.size() >= needed) {
+        frame->msg = rx_buf_.data() + 3;
+        frame->msg_len = msg_size;
+        // uncomment for even more debugging
+#ifdef HELPER_LOG_PACKETS
+        ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(frame->msg, frame->msg_len).c_str());
+#endif
+        rx_buf_.consume(needed);
+        return APIError::OK;
+      }
+    }
+    if (socket_drained)
+      return APIError::WOULD_BLOCK;
 
-  if (rx_buf_len_ < msg_size) {
-    // more data to read
-    size_t to_read = msg_size - rx_buf_len_;
-    ssize_t received = socket_->read(&rx_buf_[rx_buf_len_], to_read);
+    // Only read when no complete frame is buffered, but then as much as the socket has
+    size_t to_read = rx_buf_.prepare(needed);
+    ssize_t received = socket_->read(rx_buf_.write_ptr(), to_read);
     if (received == -1) {
       if (errno == EWOULDBLOCK || errno == EAGAIN) {
         return APIError::WOULD_BLOCK;
@@ -245,23 +348,10 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
       HELPER_LOG("Connection closed");
       return APIError::CONNECTION_CLOSED;
     }
-    rx_buf_len_ += received;
-    if ((size_t) received != to_read) {
-      // not all read
-      return APIError::WOULD_BLOCK;
-    }
+    rx_buf_.commit(received);
+    // A short read means there is nothing more to read for now
+    socket_drained = (size_t) received != to_read;
   }
-
-  // uncomment for even more debugging
-#ifdef HELPER_LOG_PACKETS
-  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
-#endif
-  frame->msg = std::move(rx_buf_);
-  // consume msg
-  rx_buf_ = {};
-  rx_buf_len_ = 0;
-  rx_header_buf_len_ = 0;
-  return APIError::OK;
 }
 
 /** To be called from read/write methods.
@@ -295,9 +385,9 @@ APIError APINoiseFrameHelper::state_action_() {
     if (aerr != APIError::OK)
       return aerr;
     // ignore contents, may be used in future for flags
-    prologue_.push_back((uint8_t) (frame.msg.size() >> 8));
-    prologue_.push_back((uint8_t) frame.msg.size());
-    prologue_.insert(prologue_.end(), frame.msg.begin(), frame.msg.end());
+    prologue_.push_back((uint8_t) (frame.msg_len >> 8));
+    prologue_.push_back((uint8_t) frame.msg_len);
+    prologue_.insert(prologue_.end(), frame.msg, frame.msg + frame.msg_len);
 
     state_ = State::SERVER_HELLO;
   }
@@ -340,7 +430,7 @@ APIError APINoiseFrameHelper::state_action_() {
       if (aerr != APIError::OK)
         return aerr;
 
-      if (frame.msg.empty()) {
+      if (frame.msg_len == 0) {
         send_explicit_handshake_reject_("Empty handshake message");
         return APIError::BAD_HANDSHAKE_ERROR_BYTE;
       } else if (frame.msg[0] != 0x00) {
@@ -351,7 +441,7 @@ APIError APINoiseFrameHelper::state_action_() {
 
       NoiseBuffer mbuf;
       noise_buffer_init(mbuf);
-      noise_buffer_set_input(mbuf, frame.msg.data() + 1, frame.msg.size() - 1);
+      noise_buffer_set_input(mbuf, frame.msg + 1, frame.msg_len - 1);
       err = noise_handshakestate_read_message(handshake_, &mbuf, nullptr);
       if (err != 0) {
         state_ = State::FAILED;
@@ -432,7 +522,8 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, frame.msg.data(), frame.msg.size(), frame.msg.size());
+  // decrypt in place, within rx_buf_
+  noise_buffer_set_inout(mbuf, frame.msg, frame.msg_len, frame.msg_len);
   err = noise_cipherstate_decrypt(recv_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -441,7 +532,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   }
 
   size_t msg_size = mbuf.size;
-  uint8_t *msg_data = frame.msg.data();
+  uint8_t *msg_data = frame.msg;
   if (msg_size < 4) {
     state_ = State::FAILED;
     HELPER_LOG("Bad data packet: size %d too short", msg_size);
@@ -460,14 +551,17 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
     return APIError::BAD_DATA_PACKET;
   }
 
-  buffer->container = std::move(frame.msg);
-  buffer->data_offset = 4;
+  buffer->data = msg_data + 4;
   buffer->data_len = data_len;
   buffer->type = type;
   return APIError::OK;
 }
-bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
+bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_queue_.has_room(); }
 APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+  PacketInfo packet{type, 0, static_cast<uint32_t>(payload_len)};
+  return this->write_packets(payload, &packet, 1);
+}
+APIError APINoiseFrameHelper::write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -479,133 +573,89 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
     return APIError::WOULD_BLOCK;
   }
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
-  }
-
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
-  const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  const size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  size_t total_len = 0;
+  for (size_t i = 0; i < count; i++)
+    total_len += 3 + 4 + packets[i].len + mac_len;
+  // Checked before encrypting, a refused message must not use up a nonce
+  if (!tx_queue_.check_limit(total_len, count)) {
+    HELPER_LOG("Send queue full, dropping %u messages", (unsigned) count);
+    return APIError::SEND_QUEUE_FULL;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    size_t padding = 0;
+    size_t msg_len = 4 + packet.len + padding;
+    size_t frame_len = 3 + msg_len + mac_len;
+    // Encrypt in place in the send queue, so that all frames go out with a single write
+    uint8_t *frame = tx_queue_.reserve(frame_len);
+
+    frame[0] = 0x01;  // indicator
+    // frame[1], frame[2] to be set later
+    const uint8_t msg_offset = 3;
+    const uint8_t payload_offset = msg_offset + 4;
+    frame[msg_offset + 0] = (uint8_t) (packet.type >> 8);  // type
+    frame[msg_offset + 1] = (uint8_t) packet.type;
+    frame[msg_offset + 2] = (uint8_t) (packet.len >> 8);  // data_len
+    frame[msg_offset + 3] = (uint8_t) packet.len;
+    // copy data
+    std::copy(data + packet.offset, data + packet.offset + packet.len, &frame[payload_offset]);
+    // fill padding with zeros
+    std::fill(&frame[payload_offset + packet.len], &frame[frame_len], 0);
+
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, &frame[msg_offset], msg_len, frame_len - msg_offset);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    frame[1] = (uint8_t) (mbuf.size >> 8);
+    frame[2] = (uint8_t) mbuf.size;
+    tx_queue_.commit(3 + mbuf.size);
   }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
-
-  struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
-  iov.iov_len = total_len;
-
-  // write raw to not have two packets sent if NAGLE disabled
-  return write_raw_(&iov, 1);
+  return try_send_tx_buf_();
 }
 APIError APINoiseFrameHelper::try_send_tx_buf_() {
-  // try send from tx_buf
-  while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
-    if (sent == -1) {
-      if (errno == EWOULDBLOCK || errno == EAGAIN)
-        break;
+  // try send from the queue, several segments per write
+  while (state_ != State::CLOSED && !tx_queue_.empty()) {
+    struct iovec iov[TX_MAX_IOV];
+    int iovcnt = tx_queue_.fill_iov(iov, TX_MAX_IOV);
+#ifdef HELPER_LOG_PACKETS
+    for (int i = 0; i < iovcnt; i++) {
+      ESP_LOGVV(TAG, "Sending raw: %s",
+                format_hex_pretty(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len).c_str());
+    }
+#endif
+    ssize_t sent = socket_->writev(iov, iovcnt);
+    if (is_would_block(sent)) {
+      break;
+    } else if (sent == -1) {
       state_ = State::FAILED;
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
-    } else if (sent == 0) {
-      break;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
+    tx_queue_.consume(sent);
   }
 
   return APIError::OK;
 }
-/** Write the data to the socket, or buffer it a write would block
+/** Write the data to the socket, or queue what a write didn't accept
  *
- * @param data The data to write
- * @param len The length of data
+ * @param iov The data to write
+ * @param iovcnt The number of iovecs
  */
 APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
   if (iovcnt == 0)
     return APIError::OK;
-  APIError aerr;
-
-  size_t total_write_len = 0;
-  for (int i = 0; i < iovcnt; i++) {
-#ifdef HELPER_LOG_PACKETS
-    ESP_LOGVV(TAG, "Sending raw: %s",
-              format_hex_pretty(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len).c_str());
-#endif
-    total_write_len += iov[i].iov_len;
-  }
-
-  if (!tx_buf_.empty()) {
-    // try to empty tx_buf_ first
-    aerr = try_send_tx_buf_();
-    if (aerr != APIError::OK && aerr != APIError::WOULD_BLOCK)
-      return aerr;
-  }
-
-  if (!tx_buf_.empty()) {
-    // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
-    return APIError::OK;
-  }
-
-  ssize_t sent = socket_->writev(iov, iovcnt);
-  if (is_would_block(sent)) {
-    // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
-    return APIError::OK;
-  } else if (sent == -1) {
-    // an error occurred
-    state_ = State::FAILED;
-    HELPER_LOG("Socket write failed with errno %d", errno);
-    return APIError::SOCKET_WRITE_FAILED;
-  } else if ((size_t) sent != total_write_len) {
-    // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
-    }
-    return APIError::OK;
-  }
-  // fully sent
-  return APIError::OK;
+  // Appended behind anything still queued to keep the stream consistent, then written together
+  tx_queue_.append(iov, iovcnt);
+  return try_send_tx_buf_();
 }
 APIError APINoiseFrameHelper::write_frame_(const uint8_t *data, size_t len) {
   uint8_t header[3];
@@ -773,7 +823,7 @@ APIError APIPlaintextFrameHelper::loop() {
     return APIError::BAD_STATE;
   }
   // try send pending TX data
-  if (!tx_buf_.empty()) {
+  if (!tx_queue_.empty()) {
     APIError err = try_send_tx_buf_();
     if (err != APIError::OK) {
       return err;
@@ -782,10 +832,11 @@ APIError APIPlaintextFrameHelper::loop() {
   return APIError::OK;
 }
 
-/** Read a packet into the rx_buf_. If successful, stores frame data in the frame parameter
+/** Read a frame into the rx_buf_. If successful, stores frame data in the frame parameter
  *
  * @param frame: The struct to hold the frame information in.
- *   msg: store the parsed frame in that struct
+ *   msg: points to the start of the frame content in rx_buf_ - this pointer is only valid until the next
+ *     try_read_frame_ call
  *
  * @return See APIError
  *
@@ -797,61 +848,48 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
     return APIError::BAD_ARG;
   }
 
-  // read header
-  while (!rx_header_parsed_) {
-    uint8_t data;
-    ssize_t received = socket_->read(&data, 1);
-    if (received == -1) {
-      if (errno == EWOULDBLOCK || errno == EAGAIN) {
-        return APIError::WOULD_BLOCK;
+  bool socket_drained = false;
+  while (true) {
+    // parse header, the size of the rest is unknown until it is complete
+    size_t needed = rx_buf_.size() + 1;
+    if (rx_buf_.size() != 0) {
+      const uint8_t *header = rx_buf_.data();
+      if (header[0] != 0x00) {
+        state_ = State::FAILED;
+        HELPER_LOG("Bad indicator byte %u", header[0]);
+        return APIError::BAD_INDICATOR;
       }
-      state_ = State::FAILED;
-      HELPER_LOG("Socket read failed with errno %d", errno);
-      return APIError::SOCKET_READ_FAILED;
-    } else if (received == 0) {
-      state_ = State::FAILED;
-      HELPER_LOG("Connection closed");
-      return APIError::CONNECTION_CLOSED;
-    }
-    rx_header_buf_.push_back(data);
-
-    // try parse header
-    if (rx_header_buf_[0] != 0x00) {
-      state_ = State::FAILED;
-      HELPER_LOG("Bad indicator byte %u", rx_header_buf_[0]);
-      return APIError::BAD_INDICATOR;
-    }
 
-    size_t i = 1;
-    uint32_t consumed = 0;
-    auto msg_size_varint = ProtoVarInt::parse(&rx_header_buf_[i], rx_header_buf_.size() - i, &consumed);
-    if (!msg_size_varint.has_value()) {
-      // not enough data there yet
-      continue;
-    }
-
-    i += consumed;
-    rx_header_parsed_len_ = msg_size_varint->as_uint32();
-
-    auto msg_type_varint = ProtoVarInt::parse(&rx_header_buf_[i], rx_header_buf_.size() - i, &consumed);
-    if (!msg_type_varint.has_value()) {
-      // not enough data there yet
-      continue;
+      size_t i = 1;
+      uint32_t consumed = 0;
+      auto msg_size_varint = ProtoVarInt::parse(&header[i], rx_buf_.size() - i, &consumed);
+      if (msg_size_varint.has_value()) {
+        i += consumed;
+        auto msg_type_varint = ProtoVarInt::parse(&header[i], rx_buf_.size() - i, &consumed);
+        if (msg_type_varint.has_value()) {
+          i += consumed;
+          // header reading done
+          needed = i + msg_size_varint->as_uint32();
+          if (rx_buf_.size() >= needed) {
+            frame->msg = rx_buf_.data() + i;
+            frame->msg_len = msg_size_varint->as_uint32();
+            frame->type = msg_type_varint->as_uint32();
+            // uncomment for even more debugging
+#ifdef HELPER_LOG_PACKETS
+            ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(frame->msg, frame->msg_len).c_str());
+#endif
+            rx_buf_.consume(needed);
+            return APIError::OK;
+          }
+        }
+      }
     }
-    rx_header_parsed_type_ = msg_type_varint->as_uint32();
-    rx_header_parsed_ = true;
-  }
-  // header reading done
-
-  // reserve space for body
-  if (rx_buf_.size() != rx_header_parsed_len_) {
-    rx_buf_.resize(rx_header_parsed_len_);
-  }
+    if (socket_drained)
+      return APIError::WOULD_BLOCK;
 
-  if (rx_buf_len_ < rx_header_parsed_len_) {
-    // more data to read
-    size_t to_read = rx_header_parsed_len_ - rx_buf_len_;
-    ssize_t received = socket_->read(&rx_buf_[rx_buf_len_], to_read);
+    // Only read when no complete frame is buffered, but then as much as the socket has
+    size_t to_read = rx_buf_.prepare(needed);
+    ssize_t received = socket_->read(rx_buf_.write_ptr(), to_read);
     if (received == -1) {
       if (errno == EWOULDBLOCK || errno == EAGAIN) {
         return APIError::WOULD_BLOCK;
@@ -864,24 +902,10 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
       HELPER_LOG("Connection closed");
       return APIError::CONNECTION_CLOSED;
     }
-    rx_buf_len_ += received;
-    if ((size_t) received != to_read) {
-      // not all read
-      return APIError::WOULD_BLOCK;
-    }
+    rx_buf_.commit(received);
+    // A short read means there is nothing more to read for now
+    socket_drained = (size_t) received != to_read;
   }
-
-  // uncomment for even more debugging
-#ifdef HELPER_LOG_PACKETS
-  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
-#endif
-  frame->msg = std::move(rx_buf_);
-  // consume msg
-  rx_buf_ = {};
-  rx_buf_len_ = 0;
-  rx_header_buf_.clear();
-  rx_header_parsed_ = false;
-  return APIError::OK;
 }
 
 APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
@@ -896,38 +920,59 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   if (aerr != APIError::OK)
     return aerr;
 
-  buffer->container = std::move(frame.msg);
-  buffer->data_offset = 0;
-  buffer->data_len = rx_header_parsed_len_;
-  buffer->type = rx_header_parsed_type_;
+  buffer->data = frame.msg;
+  buffer->data_len = frame.msg_len;
+  buffer->type = frame.type;
   return APIError::OK;
 }
-bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
+bool APIPlaintextFrameHelper::can_write_without_blocking() {
+  return state_ == State::DATA && tx_queue_.has_room();
+}
 APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+  PacketInfo packet{type, 0, static_cast<uint32_t>(payload_len)};
+  return this->write_packets(payload, &packet, 1);
+}
+APIError APIPlaintextFrameHelper::write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  size_t total_len = 0;
+  for (size_t i = 0; i < count; i++)
+    total_len += 1 + ProtoSize::varint(packets[i].len) + ProtoSize::varint(uint32_t(packets[i].type)) + packets[i].len;
+  if (!tx_queue_.check_limit(total_len, count)) {
+    HELPER_LOG("Send queue full, dropping %u messages", (unsigned) count);
+    return APIError::SEND_QUEUE_FULL;
+  }
 
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+  // Build the frames in the send queue, so that they go out with a single write
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    const uint32_t header_len = 1 + ProtoSize::varint(packet.len) + ProtoSize::varint(uint32_t(packet.type));
+    uint8_t *frame = tx_queue_.reserve(header_len + packet.len);
+    ProtoWriteBuffer header(frame, header_len);
+    header.write(0x00);
+    header.encode_varint_raw(packet.len);
+    header.encode_varint_raw(uint32_t(packet.type));
+    header.check_end();
+    std::copy(data + packet.offset, data + packet.offset + packet.len, frame + header_len);
+    tx_queue_.commit(header_len + packet.len);
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+  return try_send_tx_buf_();
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
-  // try send from tx_buf
-  while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
+  // try send from the queue, several segments per write
+  while (state_ != State::CLOSED && !tx_queue_.empty()) {
+    struct iovec iov[TX_MAX_IOV];
+    int iovcnt = tx_queue_.fill_iov(iov, TX_MAX_IOV);
+#ifdef HELPER_LOG_PACKETS
+    for (int i = 0; i < iovcnt; i++) {
+      ESP_LOGVV(TAG, "Sending raw: %s",
+                format_hex_pretty(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len).c_str());
+    }
+#endif
+    ssize_t sent = socket_->writev(iov, iovcnt);
     if (is_would_block(sent)) {
       break;
     } else if (sent == -1) {
@@ -935,78 +980,11 @@ APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
+    tx_queue_.consume(sent);
   }
 
   return APIError::OK;
 }
-/** Write the data to the socket, or buffer it a write would block
- *
- * @param data The data to write
- * @param len The length of data
- */
-APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
-  if (iovcnt == 0)
-    return APIError::OK;
-  APIError aerr;
-
-  size_t total_write_len = 0;
-  for (int i = 0; i < iovcnt; i++) {
-#ifdef HELPER_LOG_PACKETS
-    ESP_LOGVV(TAG, "Sending raw: %s",
-              format_hex_pretty(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len).c_str());
-#endif
-    total_write_len += iov[i].iov_len;
-  }
-
-  if (!tx_buf_.empty()) {
-    // try to empty tx_buf_ first
-    aerr = try_send_tx_buf_();
-    if (aerr != APIError::OK && aerr != APIError::WOULD_BLOCK)
-      return aerr;
-  }
-
-  if (!tx_buf_.empty()) {
-    // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
-    return APIError::OK;
-  }
-
-  ssize_t sent = socket_->writev(iov, iovcnt);
-  if (is_would_block(sent)) {
-    // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
-    return APIError::OK;
-  } else if (sent == -1) {
-    // an error occurred
-    state_ = State::FAILED;
-    HELPER_LOG("Socket write failed with errno %d", errno);
-    return APIError::SOCKET_WRITE_FAILED;
-  } else if ((size_t) sent != total_write_len) {
-    // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
-    }
-    return APIError::OK;
-  }
-  // fully sent
-  return APIError::OK;
-}
 
 APIError APIPlaintextFrameHelper::close() {
   state_ = State::CLOSED;
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <deque>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -17,17 +18,17 @@ namespace esphome {
 namespace api {
 
 struct ReadPacketBuffer {
-  std::vector<uint8_t> container;
+  /// Message data, points into the receive buffer of the frame helper and is only valid until the next read_packet().
+  uint8_t *data;
   uint16_t type;
-  size_t data_offset;
   size_t data_len;
 };
 
-struct PacketBuffer {
-  const std::vector<uint8_t> container;
+/// Location of one encoded message in a buffer holding several of them, see APIFrameHelper::write_packets().
+struct PacketInfo {
   uint16_t type;
-  uint8_t data_offset;
-  uint8_t data_len;
+  uint32_t offset;
+  uint32_t len;
 };
 
 enum class APIError : int {
@@ -54,10 +55,102 @@ enum class APIError : int {
   HANDSHAKESTATE_SPLIT_FAILED = 1020,
   BAD_HANDSHAKE_ERROR_BYTE = 1021,
   CONNECTION_CLOSED = 1022,
+  SEND_QUEUE_FULL = 1023,
 };
 
 const char *api_error_to_str(APIError err);
 
+/** Receive buffer of a frame helper.
+ *
+ * The helpers read as much as the socket has available into it in one call and then parse (and decrypt) the frames
+ * in place, one after another. Data is only moved to make room for a read, so a frame handed out stays valid until
+ * the helper reads from the socket again, which it only does once no complete frame is left.
+ */
+class APIFrameRxBuffer {
+ public:
+  /// Start of the data that hasn't been consumed yet.
+  uint8_t *data() { return this->buf_.data() + this->start_; }
+  /// Number of bytes that haven't been consumed yet.
+  size_t size() const { return this->end_ - this->start_; }
+  /// Mark the first len bytes as parsed.
+  void consume(size_t len) { this->start_ += len; }
+  /** Make room for reading, with space for at least needed unconsumed bytes. Invalidates frames handed out before.
+   *
+   * @return The number of bytes that can be read to write_ptr(), always at least one.
+   */
+  size_t prepare(size_t needed);
+  uint8_t *write_ptr() { return this->buf_.data() + this->end_; }
+  /// Add len bytes that were read to write_ptr().
+  void commit(size_t len) { this->end_ += len; }
+
+ protected:
+  std::vector<uint8_t> buf_;
+  size_t start_{0};
+  size_t end_{0};
+};
+
+/** Send queue of a frame helper, holding the data the socket didn't accept yet.
+ *
+ * Frames are built (and encrypted) directly in the queue, in fixed-size segments that are written with writev() and
+ * recycled once sent. So a client that falls behind costs neither moving the remaining data nor reallocating. A
+ * frame never spans two segments; one that doesn't fit into a segment gets a dedicated segment of its size.
+ *
+ * Writes of messages that would make the queue exceed its limit are refused and counted, see check_limit().
+ */
+class APIFrameTxQueue {
+ public:
+  /// Size of a pooled segment, about the payload of one TCP segment.
+  static constexpr size_t SEGMENT_SIZE = 1460;
+
+  bool empty() const { return this->size_ == 0; }
+  /// Number of queued bytes.
+  size_t size() const { return this->size_; }
+
+  /// Return len contiguous bytes of space at the end of the queue, to be added with commit().
+  uint8_t *reserve(size_t len);
+  /// Add the first len bytes of the space returned by reserve().
+  void commit(size_t len);
+  /// Add a copy of the data.
+  void append(const struct iovec *iov, int iovcnt);
+  /// Point up to max_iov iovecs at the queued data, returns the number used.
+  int fill_iov(struct iovec *iov, int max_iov) const;
+  /// Remove the first len bytes after they were written.
+  void consume(size_t len);
+
+  /** Whether messages with an encoded size of len may be added.
+   *
+   * Refuses them and counts them as dropped if the queue would exceed its limit. A message is always accepted into
+   * an empty queue, so that a single large message can't get stuck.
+   */
+  bool check_limit(size_t len, size_t messages);
+  /// Limit for the number of queued bytes, 0 for no limit.
+  void set_limit(size_t limit) { this->limit_ = limit; }
+  size_t get_limit() const { return this->limit_; }
+  /// Whether another message can be queued without reaching the limit.
+  bool has_room() const { return this->limit_ == 0 || this->size_ < this->limit_; }
+
+  size_t get_peak_size() const { return this->peak_size_; }
+  uint32_t get_dropped_messages() const { return this->dropped_messages_; }
+  uint32_t get_dropped_bytes() const { return this->dropped_bytes_; }
+
+ protected:
+  struct Segment {
+    std::unique_ptr<uint8_t[]> data;
+    size_t capacity;
+    size_t start;
+    size_t end;
+  };
+
+  std::deque<Segment> segments_;
+  /// Sent segments of SEGMENT_SIZE, kept for reuse.
+  std::vector<std::unique_ptr<uint8_t[]>> pool_;
+  size_t size_{0};
+  size_t limit_{0};
+  size_t peak_size_{0};
+  uint32_t dropped_messages_{0};
+  uint32_t dropped_bytes_{0};
+};
+
 class APIFrameHelper {
  public:
   virtual ~APIFrameHelper() = default;
@@ -65,7 +158,13 @@ class APIFrameHelper {
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
+  /// Whether the socket or the receive buffer may have data to read, see socket::Socket::ready().
+  virtual bool is_socket_ready() const = 0;
   virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /// Write several messages stored one after another in data, each in its own frame, with a single socket write.
+  virtual APIError write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) = 0;
+  /// Queue of the data that couldn't be written to the socket yet.
+  virtual APIFrameTxQueue &get_tx_queue() = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
@@ -84,7 +183,12 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
+  bool is_socket_ready() const override {
+    return this->rx_buf_.size() != 0 || (this->socket_ != nullptr && this->socket_->ready());
+  }
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) override;
+  APIFrameTxQueue &get_tx_queue() override { return this->tx_queue_; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -96,7 +200,9 @@ class APINoiseFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    /// Frame content, points into rx_buf_.
+    uint8_t *msg;
+    uint16_t msg_len;
   };
 
   APIError state_action_();
@@ -111,12 +217,9 @@ class APINoiseFrameHelper : public APIFrameHelper {
   std::unique_ptr<socket::Socket> socket_;
 
   std::string info_;
-  uint8_t rx_header_buf_[3];
-  size_t rx_header_buf_len_ = 0;
-  std::vector<uint8_t> rx_buf_;
-  size_t rx_buf_len_ = 0;
+  APIFrameRxBuffer rx_buf_;
 
-  std::vector<uint8_t> tx_buf_;
+  APIFrameTxQueue tx_queue_;
   std::vector<uint8_t> prologue_;
 
   std::shared_ptr<APINoiseContext> ctx_;
@@ -147,7 +250,12 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
+  bool is_socket_ready() const override {
+    return this->rx_buf_.size() != 0 || (this->socket_ != nullptr && this->socket_->ready());
+  }
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) override;
+  APIFrameTxQueue &get_tx_queue() override { return this->tx_queue_; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -159,25 +267,20 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    /// Frame content, points into rx_buf_.
+    uint8_t *msg;
+    uint32_t msg_len;
+    uint32_t type;
   };
 
   APIError try_read_frame_(ParsedFrame *frame);
   APIError try_send_tx_buf_();
-  APIError write_raw_(const struct iovec *iov, int iovcnt);
 
   std::unique_ptr<socket::Socket> socket_;
 
   std::string info_;
-  std::vector<uint8_t> rx_header_buf_;
-  bool rx_header_parsed_ = false;
-  uint32_t rx_header_parsed_type_ = 0;
-  uint32_t rx_header_parsed_len_ = 0;
-
-  std::vector<uint8_t> rx_buf_;
-  size_t rx_buf_len_ = 0;
-
-  std::vector<uint8_t> tx_buf_;
+  APIFrameRxBuffer rx_buf_;
+  APIFrameTxQueue tx_queue_;
 
   enum class State {
     INITIALIZE = 1,
@@ -621,6 +621,12 @@ void HelloRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->client_info);
   buffer.encode_uint32(2, this->api_version_major);
   buffer.encode_uint32(3, this->api_version_minor);
+  buffer.check_end();
+}
+void HelloRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->client_info);
+  ProtoSize::add_uint32(total_size, 2, this->api_version_major);
+  ProtoSize::add_uint32(total_size, 3, this->api_version_minor);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HelloRequest::dump_to(std::string &out) const {
@@ -675,6 +681,13 @@ void HelloResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->api_version_minor);
   buffer.encode_string(3, this->server_info);
   buffer.encode_string(4, this->name);
+  buffer.check_end();
+}
+void HelloResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->api_version_major);
+  ProtoSize::add_uint32(total_size, 2, this->api_version_minor);
+  ProtoSize::add_string(total_size, 3, this->server_info);
+  ProtoSize::add_string(total_size, 4, this->name);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HelloResponse::dump_to(std::string &out) const {
@@ -710,7 +723,13 @@ bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value
       return false;
   }
 }
-void ConnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->password); }
+void ConnectRequest::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_string(1, this->password);
+  buffer.check_end();
+}
+void ConnectRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->password);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ConnectRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -731,7 +750,13 @@ bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
       return false;
   }
 }
-void ConnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
+void ConnectResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_bool(1, this->invalid_password);
+  buffer.check_end();
+}
+void ConnectResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->invalid_password);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ConnectResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -742,23 +767,28 @@ void ConnectResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void DisconnectRequest::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void DisconnectRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DisconnectRequest::dump_to(std::string &out) const { out.append("DisconnectRequest {}"); }
 #endif
-void DisconnectResponse::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void DisconnectResponse::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DisconnectResponse::dump_to(std::string &out) const { out.append("DisconnectResponse {}"); }
 #endif
-void PingRequest::encode(ProtoWriteBuffer buffer) const {}
+void PingRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void PingRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void PingRequest::dump_to(std::string &out) const { out.append("PingRequest {}"); }
 #endif
-void PingResponse::encode(ProtoWriteBuffer buffer) const {}
+void PingResponse::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void PingResponse::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void PingResponse::dump_to(std::string &out) const { out.append("PingResponse {}"); }
 #endif
-void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const {}
+void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void DeviceInfoRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DeviceInfoRequest::dump_to(std::string &out) const { out.append("DeviceInfoRequest {}"); }
 #endif
@@ -860,6 +890,26 @@ void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(14, this->legacy_voice_assistant_version);
   buffer.encode_uint32(17, this->voice_assistant_feature_flags);
   buffer.encode_string(16, this->suggested_area);
+  buffer.check_end();
+}
+void DeviceInfoResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->uses_password);
+  ProtoSize::add_string(total_size, 2, this->name);
+  ProtoSize::add_string(total_size, 3, this->mac_address);
+  ProtoSize::add_string(total_size, 4, this->esphome_version);
+  ProtoSize::add_string(total_size, 5, this->compilation_time);
+  ProtoSize::add_string(total_size, 6, this->model);
+  ProtoSize::add_bool(total_size, 7, this->has_deep_sleep);
+  ProtoSize::add_string(total_size, 8, this->project_name);
+  ProtoSize::add_string(total_size, 9, this->project_version);
+  ProtoSize::add_uint32(total_size, 10, this->webserver_port);
+  ProtoSize::add_uint32(total_size, 11, this->legacy_bluetooth_proxy_version);
+  ProtoSize::add_uint32(total_size, 15, this->bluetooth_proxy_feature_flags);
+  ProtoSize::add_string(total_size, 12, this->manufacturer);
+  ProtoSize::add_string(total_size, 13, this->friendly_name);
+  ProtoSize::add_uint32(total_size, 14, this->legacy_voice_assistant_version);
+  ProtoSize::add_uint32(total_size, 17, this->voice_assistant_feature_flags);
+  ProtoSize::add_string(total_size, 16, this->suggested_area);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DeviceInfoResponse::dump_to(std::string &out) const {
@@ -940,15 +990,18 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void ListEntitiesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 #endif
-void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void ListEntitiesDoneResponse::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
 #endif
-void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void SubscribeStatesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
 #endif
@@ -1016,6 +1069,18 @@ void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->disabled_by_default);
   buffer.encode_string(8, this->icon);
   buffer.encode_enum<enums::EntityCategory>(9, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesBinarySensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->device_class);
+  ProtoSize::add_bool(total_size, 6, this->is_status_binary_sensor);
+  ProtoSize::add_bool(total_size, 7, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 8, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 9, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
@@ -1088,6 +1153,12 @@ void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->missing_state);
+  buffer.check_end();
+}
+void BinarySensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->missing_state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BinarySensorStateResponse::dump_to(std::string &out) const {
@@ -1187,6 +1258,21 @@ void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(10, this->icon);
   buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
   buffer.encode_bool(12, this->supports_stop);
+  buffer.check_end();
+}
+void ListEntitiesCoverResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_bool(total_size, 5, this->assumed_state);
+  ProtoSize::add_bool(total_size, 6, this->supports_position);
+  ProtoSize::add_bool(total_size, 7, this->supports_tilt);
+  ProtoSize::add_string(total_size, 8, this->device_class);
+  ProtoSize::add_bool(total_size, 9, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 10, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 11, this->entity_category);
+  ProtoSize::add_bool(total_size, 12, this->supports_stop);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesCoverResponse::dump_to(std::string &out) const {
@@ -1281,6 +1367,14 @@ void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(3, this->position);
   buffer.encode_float(4, this->tilt);
   buffer.encode_enum<enums::CoverOperation>(5, this->current_operation);
+  buffer.check_end();
+}
+void CoverStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::LegacyCoverState>(total_size, 2, this->legacy_state);
+  ProtoSize::add_float(total_size, 3, this->position);
+  ProtoSize::add_float(total_size, 4, this->tilt);
+  ProtoSize::add_enum<enums::CoverOperation>(total_size, 5, this->current_operation);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CoverStateResponse::dump_to(std::string &out) const {
@@ -1364,6 +1458,17 @@ void CoverCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->has_tilt);
   buffer.encode_float(7, this->tilt);
   buffer.encode_bool(8, this->stop);
+  buffer.check_end();
+}
+void CoverCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->has_legacy_command);
+  ProtoSize::add_enum<enums::LegacyCoverCommand>(total_size, 3, this->legacy_command);
+  ProtoSize::add_bool(total_size, 4, this->has_position);
+  ProtoSize::add_float(total_size, 5, this->position);
+  ProtoSize::add_bool(total_size, 6, this->has_tilt);
+  ProtoSize::add_float(total_size, 7, this->tilt);
+  ProtoSize::add_bool(total_size, 8, this->stop);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CoverCommandRequest::dump_to(std::string &out) const {
@@ -1487,6 +1592,23 @@ void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->supported_preset_modes) {
     buffer.encode_string(12, it, true);
   }
+  buffer.check_end();
+}
+void ListEntitiesFanResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_bool(total_size, 5, this->supports_oscillation);
+  ProtoSize::add_bool(total_size, 6, this->supports_speed);
+  ProtoSize::add_bool(total_size, 7, this->supports_direction);
+  ProtoSize::add_int32(total_size, 8, this->supported_speed_count);
+  ProtoSize::add_bool(total_size, 9, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 10, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 11, this->entity_category);
+  for (const auto &it : this->supported_preset_modes) {
+    ProtoSize::add_string(total_size, 12, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesFanResponse::dump_to(std::string &out) const {
@@ -1600,6 +1722,16 @@ void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::FanDirection>(5, this->direction);
   buffer.encode_int32(6, this->speed_level);
   buffer.encode_string(7, this->preset_mode);
+  buffer.check_end();
+}
+void FanStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->oscillating);
+  ProtoSize::add_enum<enums::FanSpeed>(total_size, 4, this->speed);
+  ProtoSize::add_enum<enums::FanDirection>(total_size, 5, this->direction);
+  ProtoSize::add_int32(total_size, 6, this->speed_level);
+  ProtoSize::add_string(total_size, 7, this->preset_mode);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void FanStateResponse::dump_to(std::string &out) const {
@@ -1721,6 +1853,22 @@ void FanCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_int32(11, this->speed_level);
   buffer.encode_bool(12, this->has_preset_mode);
   buffer.encode_string(13, this->preset_mode);
+  buffer.check_end();
+}
+void FanCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->has_state);
+  ProtoSize::add_bool(total_size, 3, this->state);
+  ProtoSize::add_bool(total_size, 4, this->has_speed);
+  ProtoSize::add_enum<enums::FanSpeed>(total_size, 5, this->speed);
+  ProtoSize::add_bool(total_size, 6, this->has_oscillating);
+  ProtoSize::add_bool(total_size, 7, this->oscillating);
+  ProtoSize::add_bool(total_size, 8, this->has_direction);
+  ProtoSize::add_enum<enums::FanDirection>(total_size, 9, this->direction);
+  ProtoSize::add_bool(total_size, 10, this->has_speed_level);
+  ProtoSize::add_int32(total_size, 11, this->speed_level);
+  ProtoSize::add_bool(total_size, 12, this->has_preset_mode);
+  ProtoSize::add_string(total_size, 13, this->preset_mode);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void FanCommandRequest::dump_to(std::string &out) const {
@@ -1880,6 +2028,28 @@ void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(13, this->disabled_by_default);
   buffer.encode_string(14, this->icon);
   buffer.encode_enum<enums::EntityCategory>(15, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesLightResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  for (const auto &it : this->supported_color_modes) {
+    ProtoSize::add_enum<enums::ColorMode>(total_size, 12, it, true);
+  }
+  ProtoSize::add_bool(total_size, 5, this->legacy_supports_brightness);
+  ProtoSize::add_bool(total_size, 6, this->legacy_supports_rgb);
+  ProtoSize::add_bool(total_size, 7, this->legacy_supports_white_value);
+  ProtoSize::add_bool(total_size, 8, this->legacy_supports_color_temperature);
+  ProtoSize::add_float(total_size, 9, this->min_mireds);
+  ProtoSize::add_float(total_size, 10, this->max_mireds);
+  for (const auto &it : this->effects) {
+    ProtoSize::add_string(total_size, 11, it, true);
+  }
+  ProtoSize::add_bool(total_size, 13, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 14, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 15, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesLightResponse::dump_to(std::string &out) const {
@@ -2038,6 +2208,22 @@ void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(12, this->cold_white);
   buffer.encode_float(13, this->warm_white);
   buffer.encode_string(9, this->effect);
+  buffer.check_end();
+}
+void LightStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->state);
+  ProtoSize::add_float(total_size, 3, this->brightness);
+  ProtoSize::add_enum<enums::ColorMode>(total_size, 11, this->color_mode);
+  ProtoSize::add_float(total_size, 10, this->color_brightness);
+  ProtoSize::add_float(total_size, 4, this->red);
+  ProtoSize::add_float(total_size, 5, this->green);
+  ProtoSize::add_float(total_size, 6, this->blue);
+  ProtoSize::add_float(total_size, 7, this->white);
+  ProtoSize::add_float(total_size, 8, this->color_temperature);
+  ProtoSize::add_float(total_size, 12, this->cold_white);
+  ProtoSize::add_float(total_size, 13, this->warm_white);
+  ProtoSize::add_string(total_size, 9, this->effect);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightStateResponse::dump_to(std::string &out) const {
@@ -2261,6 +2447,36 @@ void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(17, this->flash_length);
   buffer.encode_bool(18, this->has_effect);
   buffer.encode_string(19, this->effect);
+  buffer.check_end();
+}
+void LightCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->has_state);
+  ProtoSize::add_bool(total_size, 3, this->state);
+  ProtoSize::add_bool(total_size, 4, this->has_brightness);
+  ProtoSize::add_float(total_size, 5, this->brightness);
+  ProtoSize::add_bool(total_size, 22, this->has_color_mode);
+  ProtoSize::add_enum<enums::ColorMode>(total_size, 23, this->color_mode);
+  ProtoSize::add_bool(total_size, 20, this->has_color_brightness);
+  ProtoSize::add_float(total_size, 21, this->color_brightness);
+  ProtoSize::add_bool(total_size, 6, this->has_rgb);
+  ProtoSize::add_float(total_size, 7, this->red);
+  ProtoSize::add_float(total_size, 8, this->green);
+  ProtoSize::add_float(total_size, 9, this->blue);
+  ProtoSize::add_bool(total_size, 10, this->has_white);
+  ProtoSize::add_float(total_size, 11, this->white);
+  ProtoSize::add_bool(total_size, 12, this->has_color_temperature);
+  ProtoSize::add_float(total_size, 13, this->color_temperature);
+  ProtoSize::add_bool(total_size, 24, this->has_cold_white);
+  ProtoSize::add_float(total_size, 25, this->cold_white);
+  ProtoSize::add_bool(total_size, 26, this->has_warm_white);
+  ProtoSize::add_float(total_size, 27, this->warm_white);
+  ProtoSize::add_bool(total_size, 14, this->has_transition_length);
+  ProtoSize::add_uint32(total_size, 15, this->transition_length);
+  ProtoSize::add_bool(total_size, 16, this->has_flash_length);
+  ProtoSize::add_uint32(total_size, 17, this->flash_length);
+  ProtoSize::add_bool(total_size, 18, this->has_effect);
+  ProtoSize::add_string(total_size, 19, this->effect);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightCommandRequest::dump_to(std::string &out) const {
@@ -2472,6 +2688,22 @@ void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::SensorLastResetType>(11, this->legacy_last_reset_type);
   buffer.encode_bool(12, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(13, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_string(total_size, 6, this->unit_of_measurement);
+  ProtoSize::add_int32(total_size, 7, this->accuracy_decimals);
+  ProtoSize::add_bool(total_size, 8, this->force_update);
+  ProtoSize::add_string(total_size, 9, this->device_class);
+  ProtoSize::add_enum<enums::SensorStateClass>(total_size, 10, this->state_class);
+  ProtoSize::add_enum<enums::SensorLastResetType>(total_size, 11, this->legacy_last_reset_type);
+  ProtoSize::add_bool(total_size, 12, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 13, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSensorResponse::dump_to(std::string &out) const {
@@ -2561,6 +2793,12 @@ void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
+  buffer.check_end();
+}
+void SensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->missing_state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SensorStateResponse::dump_to(std::string &out) const {
@@ -2646,6 +2884,18 @@ void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
   buffer.encode_string(9, this->device_class);
+  buffer.check_end();
+}
+void ListEntitiesSwitchResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->assumed_state);
+  ProtoSize::add_bool(total_size, 7, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 8, this->entity_category);
+  ProtoSize::add_string(total_size, 9, this->device_class);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
@@ -2713,6 +2963,11 @@ bool SwitchStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
+  buffer.check_end();
+}
+void SwitchStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SwitchStateResponse::dump_to(std::string &out) const {
@@ -2752,6 +3007,11 @@ bool SwitchCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void SwitchCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
+  buffer.check_end();
+}
+void SwitchCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SwitchCommandRequest::dump_to(std::string &out) const {
@@ -2827,6 +3087,17 @@ void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_string(8, this->device_class);
+  buffer.check_end();
+}
+void ListEntitiesTextSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_string(total_size, 8, this->device_class);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
@@ -2901,6 +3172,12 @@ void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
+  buffer.check_end();
+}
+void TextSensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->missing_state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TextSensorStateResponse::dump_to(std::string &out) const {
@@ -2938,6 +3215,11 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 void SubscribeLogsRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LogLevel>(1, this->level);
   buffer.encode_bool(2, this->dump_config);
+  buffer.check_end();
+}
+void SubscribeLogsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum<enums::LogLevel>(total_size, 1, this->level);
+  ProtoSize::add_bool(total_size, 2, this->dump_config);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeLogsRequest::dump_to(std::string &out) const {
@@ -2981,6 +3263,12 @@ void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LogLevel>(1, this->level);
   buffer.encode_string(3, this->message);
   buffer.encode_bool(4, this->send_failed);
+  buffer.check_end();
+}
+void SubscribeLogsResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum<enums::LogLevel>(total_size, 1, this->level);
+  ProtoSize::add_string(total_size, 3, this->message);
+  ProtoSize::add_bool(total_size, 4, this->send_failed);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeLogsResponse::dump_to(std::string &out) const {
@@ -3000,7 +3288,8 @@ void SubscribeLogsResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void SubscribeHomeassistantServicesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeassistantServicesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeassistantServicesRequest {}");
@@ -3023,6 +3312,11 @@ bool HomeassistantServiceMap::decode_length(uint32_t field_id, ProtoLengthDelimi
 void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->key);
   buffer.encode_string(2, this->value);
+  buffer.check_end();
+}
+void HomeassistantServiceMap::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->value);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeassistantServiceMap::dump_to(std::string &out) const {
@@ -3082,6 +3376,20 @@ void HomeassistantServiceResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<HomeassistantServiceMap>(4, it, true);
   }
   buffer.encode_bool(5, this->is_event);
+  buffer.check_end();
+}
+void HomeassistantServiceResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->service);
+  for (const auto &it : this->data) {
+    ProtoSize::add_message<HomeassistantServiceMap>(total_size, 2, it, true);
+  }
+  for (const auto &it : this->data_template) {
+    ProtoSize::add_message<HomeassistantServiceMap>(total_size, 3, it, true);
+  }
+  for (const auto &it : this->variables) {
+    ProtoSize::add_message<HomeassistantServiceMap>(total_size, 4, it, true);
+  }
+  ProtoSize::add_bool(total_size, 5, this->is_event);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeassistantServiceResponse::dump_to(std::string &out) const {
@@ -3115,7 +3423,8 @@ void HomeassistantServiceResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void SubscribeHomeAssistantStatesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeAssistantStatesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeAssistantStatesRequest {}");
@@ -3149,6 +3458,12 @@ void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const
   buffer.encode_string(1, this->entity_id);
   buffer.encode_string(2, this->attribute);
   buffer.encode_bool(3, this->once);
+  buffer.check_end();
+}
+void SubscribeHomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->entity_id);
+  ProtoSize::add_string(total_size, 2, this->attribute);
+  ProtoSize::add_bool(total_size, 3, this->once);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
@@ -3190,6 +3505,12 @@ void HomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->entity_id);
   buffer.encode_string(2, this->state);
   buffer.encode_string(3, this->attribute);
+  buffer.check_end();
+}
+void HomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->entity_id);
+  ProtoSize::add_string(total_size, 2, this->state);
+  ProtoSize::add_string(total_size, 3, this->attribute);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeAssistantStateResponse::dump_to(std::string &out) const {
@@ -3209,7 +3530,8 @@ void HomeAssistantStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void GetTimeRequest::encode(ProtoWriteBuffer buffer) const {}
+void GetTimeRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void GetTimeRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
 #endif
@@ -3223,7 +3545,13 @@ bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
       return false;
   }
 }
-void GetTimeResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->epoch_seconds); }
+void GetTimeResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_fixed32(1, this->epoch_seconds);
+  buffer.check_end();
+}
+void GetTimeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->epoch_seconds);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void GetTimeResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3258,6 +3586,11 @@ bool ListEntitiesServicesArgument::decode_length(uint32_t field_id, ProtoLengthD
 void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->name);
   buffer.encode_enum<enums::ServiceArgType>(2, this->type);
+  buffer.check_end();
+}
+void ListEntitiesServicesArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_enum<enums::ServiceArgType>(total_size, 2, this->type);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesServicesArgument::dump_to(std::string &out) const {
@@ -3303,6 +3636,14 @@ void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->args) {
     buffer.encode_message<ListEntitiesServicesArgument>(3, it, true);
   }
+  buffer.check_end();
+}
+void ListEntitiesServicesResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  for (const auto &it : this->args) {
+    ProtoSize::add_message<ListEntitiesServicesArgument>(total_size, 3, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesServicesResponse::dump_to(std::string &out) const {
@@ -3397,6 +3738,26 @@ void ExecuteServiceArgument::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->string_array) {
     buffer.encode_string(9, it, true);
   }
+  buffer.check_end();
+}
+void ExecuteServiceArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->bool_);
+  ProtoSize::add_int32(total_size, 2, this->legacy_int);
+  ProtoSize::add_float(total_size, 3, this->float_);
+  ProtoSize::add_string(total_size, 4, this->string_);
+  ProtoSize::add_sint32(total_size, 5, this->int_);
+  for (const auto it : this->bool_array) {
+    ProtoSize::add_bool(total_size, 6, it, true);
+  }
+  for (const auto &it : this->int_array) {
+    ProtoSize::add_sint32(total_size, 7, it, true);
+  }
+  for (const auto &it : this->float_array) {
+    ProtoSize::add_float(total_size, 8, it, true);
+  }
+  for (const auto &it : this->string_array) {
+    ProtoSize::add_string(total_size, 9, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ExecuteServiceArgument::dump_to(std::string &out) const {
@@ -3478,6 +3839,13 @@ void ExecuteServiceRequest::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->args) {
     buffer.encode_message<ExecuteServiceArgument>(2, it, true);
   }
+  buffer.check_end();
+}
+void ExecuteServiceRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  for (const auto &it : this->args) {
+    ProtoSize::add_message<ExecuteServiceArgument>(total_size, 2, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ExecuteServiceRequest::dump_to(std::string &out) const {
@@ -3550,6 +3918,16 @@ void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(5, this->disabled_by_default);
   buffer.encode_string(6, this->icon);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesCameraResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_bool(total_size, 5, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 6, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesCameraResponse::dump_to(std::string &out) const {
@@ -3620,6 +3998,12 @@ void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->data);
   buffer.encode_bool(3, this->done);
+  buffer.check_end();
+}
+void CameraImageResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->data);
+  ProtoSize::add_bool(total_size, 3, this->done);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CameraImageResponse::dump_to(std::string &out) const {
@@ -3657,6 +4041,11 @@ bool CameraImageRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 void CameraImageRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->single);
   buffer.encode_bool(2, this->stream);
+  buffer.check_end();
+}
+void CameraImageRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->single);
+  ProtoSize::add_bool(total_size, 2, this->stream);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CameraImageRequest::dump_to(std::string &out) const {
@@ -3828,6 +4217,46 @@ void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(23, this->supports_target_humidity);
   buffer.encode_float(24, this->visual_min_humidity);
   buffer.encode_float(25, this->visual_max_humidity);
+  buffer.check_end();
+}
+void ListEntitiesClimateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_bool(total_size, 5, this->supports_current_temperature);
+  ProtoSize::add_bool(total_size, 6, this->supports_two_point_target_temperature);
+  for (const auto &it : this->supported_modes) {
+    ProtoSize::add_enum<enums::ClimateMode>(total_size, 7, it, true);
+  }
+  ProtoSize::add_float(total_size, 8, this->visual_min_temperature);
+  ProtoSize::add_float(total_size, 9, this->visual_max_temperature);
+  ProtoSize::add_float(total_size, 10, this->visual_target_temperature_step);
+  ProtoSize::add_bool(total_size, 11, this->legacy_supports_away);
+  ProtoSize::add_bool(total_size, 12, this->supports_action);
+  for (const auto &it : this->supported_fan_modes) {
+    ProtoSize::add_enum<enums::ClimateFanMode>(total_size, 13, it, true);
+  }
+  for (const auto &it : this->supported_swing_modes) {
+    ProtoSize::add_enum<enums::ClimateSwingMode>(total_size, 14, it, true);
+  }
+  for (const auto &it : this->supported_custom_fan_modes) {
+    ProtoSize::add_string(total_size, 15, it, true);
+  }
+  for (const auto &it : this->supported_presets) {
+    ProtoSize::add_enum<enums::ClimatePreset>(total_size, 16, it, true);
+  }
+  for (const auto &it : this->supported_custom_presets) {
+    ProtoSize::add_string(total_size, 17, it, true);
+  }
+  ProtoSize::add_bool(total_size, 18, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 19, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 20, this->entity_category);
+  ProtoSize::add_float(total_size, 21, this->visual_current_temperature_step);
+  ProtoSize::add_bool(total_size, 22, this->supports_current_humidity);
+  ProtoSize::add_bool(total_size, 23, this->supports_target_humidity);
+  ProtoSize::add_float(total_size, 24, this->visual_min_humidity);
+  ProtoSize::add_float(total_size, 25, this->visual_max_humidity);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesClimateResponse::dump_to(std::string &out) const {
@@ -4048,6 +4477,24 @@ void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(13, this->custom_preset);
   buffer.encode_float(14, this->current_humidity);
   buffer.encode_float(15, this->target_humidity);
+  buffer.check_end();
+}
+void ClimateStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::ClimateMode>(total_size, 2, this->mode);
+  ProtoSize::add_float(total_size, 3, this->current_temperature);
+  ProtoSize::add_float(total_size, 4, this->target_temperature);
+  ProtoSize::add_float(total_size, 5, this->target_temperature_low);
+  ProtoSize::add_float(total_size, 6, this->target_temperature_high);
+  ProtoSize::add_bool(total_size, 7, this->unused_legacy_away);
+  ProtoSize::add_enum<enums::ClimateAction>(total_size, 8, this->action);
+  ProtoSize::add_enum<enums::ClimateFanMode>(total_size, 9, this->fan_mode);
+  ProtoSize::add_enum<enums::ClimateSwingMode>(total_size, 10, this->swing_mode);
+  ProtoSize::add_string(total_size, 11, this->custom_fan_mode);
+  ProtoSize::add_enum<enums::ClimatePreset>(total_size, 12, this->preset);
+  ProtoSize::add_string(total_size, 13, this->custom_preset);
+  ProtoSize::add_float(total_size, 14, this->current_humidity);
+  ProtoSize::add_float(total_size, 15, this->target_humidity);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ClimateStateResponse::dump_to(std::string &out) const {
@@ -4256,6 +4703,32 @@ void ClimateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(21, this->custom_preset);
   buffer.encode_bool(22, this->has_target_humidity);
   buffer.encode_float(23, this->target_humidity);
+  buffer.check_end();
+}
+void ClimateCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->has_mode);
+  ProtoSize::add_enum<enums::ClimateMode>(total_size, 3, this->mode);
+  ProtoSize::add_bool(total_size, 4, this->has_target_temperature);
+  ProtoSize::add_float(total_size, 5, this->target_temperature);
+  ProtoSize::add_bool(total_size, 6, this->has_target_temperature_low);
+  ProtoSize::add_float(total_size, 7, this->target_temperature_low);
+  ProtoSize::add_bool(total_size, 8, this->has_target_temperature_high);
+  ProtoSize::add_float(total_size, 9, this->target_temperature_high);
+  ProtoSize::add_bool(total_size, 10, this->unused_has_legacy_away);
+  ProtoSize::add_bool(total_size, 11, this->unused_legacy_away);
+  ProtoSize::add_bool(total_size, 12, this->has_fan_mode);
+  ProtoSize::add_enum<enums::ClimateFanMode>(total_size, 13, this->fan_mode);
+  ProtoSize::add_bool(total_size, 14, this->has_swing_mode);
+  ProtoSize::add_enum<enums::ClimateSwingMode>(total_size, 15, this->swing_mode);
+  ProtoSize::add_bool(total_size, 16, this->has_custom_fan_mode);
+  ProtoSize::add_string(total_size, 17, this->custom_fan_mode);
+  ProtoSize::add_bool(total_size, 18, this->has_preset);
+  ProtoSize::add_enum<enums::ClimatePreset>(total_size, 19, this->preset);
+  ProtoSize::add_bool(total_size, 20, this->has_custom_preset);
+  ProtoSize::add_string(total_size, 21, this->custom_preset);
+  ProtoSize::add_bool(total_size, 22, this->has_target_humidity);
+  ProtoSize::add_float(total_size, 23, this->target_humidity);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ClimateCommandRequest::dump_to(std::string &out) const {
@@ -4444,6 +4917,22 @@ void ListEntitiesNumberResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(11, this->unit_of_measurement);
   buffer.encode_enum<enums::NumberMode>(12, this->mode);
   buffer.encode_string(13, this->device_class);
+  buffer.check_end();
+}
+void ListEntitiesNumberResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_float(total_size, 6, this->min_value);
+  ProtoSize::add_float(total_size, 7, this->max_value);
+  ProtoSize::add_float(total_size, 8, this->step);
+  ProtoSize::add_bool(total_size, 9, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 10, this->entity_category);
+  ProtoSize::add_string(total_size, 11, this->unit_of_measurement);
+  ProtoSize::add_enum<enums::NumberMode>(total_size, 12, this->mode);
+  ProtoSize::add_string(total_size, 13, this->device_class);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesNumberResponse::dump_to(std::string &out) const {
@@ -4535,6 +5024,12 @@ void NumberStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
+  buffer.check_end();
+}
+void NumberStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->missing_state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void NumberStateResponse::dump_to(std::string &out) const {
@@ -4573,6 +5068,11 @@ bool NumberCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void NumberCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
+  buffer.check_end();
+}
+void NumberCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void NumberCommandRequest::dump_to(std::string &out) const {
@@ -4651,6 +5151,19 @@ void ListEntitiesSelectResponse::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_bool(7, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesSelectResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  for (const auto &it : this->options) {
+    ProtoSize::add_string(total_size, 6, it, true);
+  }
+  ProtoSize::add_bool(total_size, 7, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 8, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSelectResponse::dump_to(std::string &out) const {
@@ -4727,6 +5240,12 @@ void SelectStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
+  buffer.check_end();
+}
+void SelectStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->missing_state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SelectStateResponse::dump_to(std::string &out) const {
@@ -4770,6 +5289,11 @@ bool SelectCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void SelectCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
+  buffer.check_end();
+}
+void SelectCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SelectCommandRequest::dump_to(std::string &out) const {
@@ -4860,6 +5384,20 @@ void ListEntitiesLockResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(9, this->supports_open);
   buffer.encode_bool(10, this->requires_code);
   buffer.encode_string(11, this->code_format);
+  buffer.check_end();
+}
+void ListEntitiesLockResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_bool(total_size, 8, this->assumed_state);
+  ProtoSize::add_bool(total_size, 9, this->supports_open);
+  ProtoSize::add_bool(total_size, 10, this->requires_code);
+  ProtoSize::add_string(total_size, 11, this->code_format);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesLockResponse::dump_to(std::string &out) const {
@@ -4935,6 +5473,11 @@ bool LockStateResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void LockStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_enum<enums::LockState>(2, this->state);
+  buffer.check_end();
+}
+void LockStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::LockState>(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LockStateResponse::dump_to(std::string &out) const {
@@ -4990,6 +5533,13 @@ void LockCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LockCommand>(2, this->command);
   buffer.encode_bool(3, this->has_code);
   buffer.encode_string(4, this->code);
+  buffer.check_end();
+}
+void LockCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::LockCommand>(total_size, 2, this->command);
+  ProtoSize::add_bool(total_size, 3, this->has_code);
+  ProtoSize::add_string(total_size, 4, this->code);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LockCommandRequest::dump_to(std::string &out) const {
@@ -5073,6 +5623,17 @@ void ListEntitiesButtonResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_string(8, this->device_class);
+  buffer.check_end();
+}
+void ListEntitiesButtonResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_string(total_size, 8, this->device_class);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesButtonResponse::dump_to(std::string &out) const {
@@ -5123,7 +5684,13 @@ bool ButtonCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
       return false;
   }
 }
-void ButtonCommandRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->key); }
+void ButtonCommandRequest::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_fixed32(1, this->key);
+  buffer.check_end();
+}
+void ButtonCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ButtonCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5173,6 +5740,14 @@ void MediaPlayerSupportedFormat::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(3, this->num_channels);
   buffer.encode_enum<enums::MediaPlayerFormatPurpose>(4, this->purpose);
   buffer.encode_uint32(5, this->sample_bytes);
+  buffer.check_end();
+}
+void MediaPlayerSupportedFormat::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->format);
+  ProtoSize::add_uint32(total_size, 2, this->sample_rate);
+  ProtoSize::add_uint32(total_size, 3, this->num_channels);
+  ProtoSize::add_enum<enums::MediaPlayerFormatPurpose>(total_size, 4, this->purpose);
+  ProtoSize::add_uint32(total_size, 5, this->sample_bytes);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerSupportedFormat::dump_to(std::string &out) const {
@@ -5269,6 +5844,20 @@ void ListEntitiesMediaPlayerResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->supported_formats) {
     buffer.encode_message<MediaPlayerSupportedFormat>(9, it, true);
   }
+  buffer.check_end();
+}
+void ListEntitiesMediaPlayerResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_bool(total_size, 8, this->supports_pause);
+  for (const auto &it : this->supported_formats) {
+    ProtoSize::add_message<MediaPlayerSupportedFormat>(total_size, 9, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesMediaPlayerResponse::dump_to(std::string &out) const {
@@ -5348,6 +5937,13 @@ void MediaPlayerStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::MediaPlayerState>(2, this->state);
   buffer.encode_float(3, this->volume);
   buffer.encode_bool(4, this->muted);
+  buffer.check_end();
+}
+void MediaPlayerStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::MediaPlayerState>(total_size, 2, this->state);
+  ProtoSize::add_float(total_size, 3, this->volume);
+  ProtoSize::add_bool(total_size, 4, this->muted);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerStateResponse::dump_to(std::string &out) const {
@@ -5437,6 +6033,18 @@ void MediaPlayerCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(7, this->media_url);
   buffer.encode_bool(8, this->has_announcement);
   buffer.encode_bool(9, this->announcement);
+  buffer.check_end();
+}
+void MediaPlayerCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->has_command);
+  ProtoSize::add_enum<enums::MediaPlayerCommand>(total_size, 3, this->command);
+  ProtoSize::add_bool(total_size, 4, this->has_volume);
+  ProtoSize::add_float(total_size, 5, this->volume);
+  ProtoSize::add_bool(total_size, 6, this->has_media_url);
+  ProtoSize::add_string(total_size, 7, this->media_url);
+  ProtoSize::add_bool(total_size, 8, this->has_announcement);
+  ProtoSize::add_bool(total_size, 9, this->announcement);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerCommandRequest::dump_to(std::string &out) const {
@@ -5494,6 +6102,10 @@ bool SubscribeBluetoothLEAdvertisementsRequest::decode_varint(uint32_t field_id,
 }
 void SubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(1, this->flags);
+  buffer.check_end();
+}
+void SubscribeBluetoothLEAdvertisementsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->flags);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeBluetoothLEAdvertisementsRequest::dump_to(std::string &out) const {
@@ -5536,6 +6148,14 @@ void BluetoothServiceData::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_uint32(2, it, true);
   }
   buffer.encode_string(3, this->data);
+  buffer.check_end();
+}
+void BluetoothServiceData::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->uuid);
+  for (const auto &it : this->legacy_data) {
+    ProtoSize::add_uint32(total_size, 2, it, true);
+  }
+  ProtoSize::add_string(total_size, 3, this->data);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothServiceData::dump_to(std::string &out) const {
@@ -5612,6 +6232,22 @@ void BluetoothLEAdvertisementResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<BluetoothServiceData>(6, it, true);
   }
   buffer.encode_uint32(7, this->address_type);
+  buffer.check_end();
+}
+void BluetoothLEAdvertisementResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_string(total_size, 2, this->name);
+  ProtoSize::add_sint32(total_size, 3, this->rssi);
+  for (const auto &it : this->service_uuids) {
+    ProtoSize::add_string(total_size, 4, it, true);
+  }
+  for (const auto &it : this->service_data) {
+    ProtoSize::add_message<BluetoothServiceData>(total_size, 5, it, true);
+  }
+  for (const auto &it : this->manufacturer_data) {
+    ProtoSize::add_message<BluetoothServiceData>(total_size, 6, it, true);
+  }
+  ProtoSize::add_uint32(total_size, 7, this->address_type);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothLEAdvertisementResponse::dump_to(std::string &out) const {
@@ -5689,6 +6325,13 @@ void BluetoothLERawAdvertisement::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_sint32(2, this->rssi);
   buffer.encode_uint32(3, this->address_type);
   buffer.encode_string(4, this->data);
+  buffer.check_end();
+}
+void BluetoothLERawAdvertisement::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_sint32(total_size, 2, this->rssi);
+  ProtoSize::add_uint32(total_size, 3, this->address_type);
+  ProtoSize::add_string(total_size, 4, this->data);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothLERawAdvertisement::dump_to(std::string &out) const {
@@ -5729,6 +6372,12 @@ void BluetoothLERawAdvertisementsResponse::encode(ProtoWriteBuffer buffer) const
   for (auto &it : this->advertisements) {
     buffer.encode_message<BluetoothLERawAdvertisement>(1, it, true);
   }
+  buffer.check_end();
+}
+void BluetoothLERawAdvertisementsResponse::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->advertisements) {
+    ProtoSize::add_message<BluetoothLERawAdvertisement>(total_size, 1, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothLERawAdvertisementsResponse::dump_to(std::string &out) const {
@@ -5769,6 +6418,13 @@ void BluetoothDeviceRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::BluetoothDeviceRequestType>(2, this->request_type);
   buffer.encode_bool(3, this->has_address_type);
   buffer.encode_uint32(4, this->address_type);
+  buffer.check_end();
+}
+void BluetoothDeviceRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_enum<enums::BluetoothDeviceRequestType>(total_size, 2, this->request_type);
+  ProtoSize::add_bool(total_size, 3, this->has_address_type);
+  ProtoSize::add_uint32(total_size, 4, this->address_type);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDeviceRequest::dump_to(std::string &out) const {
@@ -5821,6 +6477,13 @@ void BluetoothDeviceConnectionResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(2, this->connected);
   buffer.encode_uint32(3, this->mtu);
   buffer.encode_int32(4, this->error);
+  buffer.check_end();
+}
+void BluetoothDeviceConnectionResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_bool(total_size, 2, this->connected);
+  ProtoSize::add_uint32(total_size, 3, this->mtu);
+  ProtoSize::add_int32(total_size, 4, this->error);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDeviceConnectionResponse::dump_to(std::string &out) const {
@@ -5857,7 +6520,13 @@ bool BluetoothGATTGetServicesRequest::decode_varint(uint32_t field_id, ProtoVarI
       return false;
   }
 }
-void BluetoothGATTGetServicesRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_uint64(1, this->address); }
+void BluetoothGATTGetServicesRequest::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint64(1, this->address);
+  buffer.check_end();
+}
+void BluetoothGATTGetServicesRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTGetServicesRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5888,6 +6557,13 @@ void BluetoothGATTDescriptor::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_uint64(1, it, true);
   }
   buffer.encode_uint32(2, this->handle);
+  buffer.check_end();
+}
+void BluetoothGATTDescriptor::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->uuid) {
+    ProtoSize::add_uint64(total_size, 1, it, true);
+  }
+  ProtoSize::add_uint32(total_size, 2, this->handle);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTDescriptor::dump_to(std::string &out) const {
@@ -5944,6 +6620,17 @@ void BluetoothGATTCharacteristic::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->descriptors) {
     buffer.encode_message<BluetoothGATTDescriptor>(4, it, true);
   }
+  buffer.check_end();
+}
+void BluetoothGATTCharacteristic::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->uuid) {
+    ProtoSize::add_uint64(total_size, 1, it, true);
+  }
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_uint32(total_size, 3, this->properties);
+  for (const auto &it : this->descriptors) {
+    ProtoSize::add_message<BluetoothGATTDescriptor>(total_size, 4, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTCharacteristic::dump_to(std::string &out) const {
@@ -6006,6 +6693,16 @@ void BluetoothGATTService::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->characteristics) {
     buffer.encode_message<BluetoothGATTCharacteristic>(3, it, true);
   }
+  buffer.check_end();
+}
+void BluetoothGATTService::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->uuid) {
+    ProtoSize::add_uint64(total_size, 1, it, true);
+  }
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  for (const auto &it : this->characteristics) {
+    ProtoSize::add_message<BluetoothGATTCharacteristic>(total_size, 3, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTService::dump_to(std::string &out) const {
@@ -6056,6 +6753,13 @@ void BluetoothGATTGetServicesResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->services) {
     buffer.encode_message<BluetoothGATTService>(2, it, true);
   }
+  buffer.check_end();
+}
+void BluetoothGATTGetServicesResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  for (const auto &it : this->services) {
+    ProtoSize::add_message<BluetoothGATTService>(total_size, 2, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTGetServicesResponse::dump_to(std::string &out) const {
@@ -6086,6 +6790,10 @@ bool BluetoothGATTGetServicesDoneResponse::decode_varint(uint32_t field_id, Prot
 }
 void BluetoothGATTGetServicesDoneResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
+  buffer.check_end();
+}
+void BluetoothGATTGetServicesDoneResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTGetServicesDoneResponse::dump_to(std::string &out) const {
@@ -6115,6 +6823,11 @@ bool BluetoothGATTReadRequest::decode_varint(uint32_t field_id, ProtoVarInt valu
 void BluetoothGATTReadRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
+  buffer.check_end();
+}
+void BluetoothGATTReadRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTReadRequest::dump_to(std::string &out) const {
@@ -6160,6 +6873,12 @@ void BluetoothGATTReadResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_string(3, this->data);
+  buffer.check_end();
+}
+void BluetoothGATTReadResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_string(total_size, 3, this->data);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTReadResponse::dump_to(std::string &out) const {
@@ -6214,6 +6933,13 @@ void BluetoothGATTWriteRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->handle);
   buffer.encode_bool(3, this->response);
   buffer.encode_string(4, this->data);
+  buffer.check_end();
+}
+void BluetoothGATTWriteRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_bool(total_size, 3, this->response);
+  ProtoSize::add_string(total_size, 4, this->data);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTWriteRequest::dump_to(std::string &out) const {
@@ -6256,6 +6982,11 @@ bool BluetoothGATTReadDescriptorRequest::decode_varint(uint32_t field_id, ProtoV
 void BluetoothGATTReadDescriptorRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
+  buffer.check_end();
+}
+void BluetoothGATTReadDescriptorRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTReadDescriptorRequest::dump_to(std::string &out) const {
@@ -6301,6 +7032,12 @@ void BluetoothGATTWriteDescriptorRequest::encode(ProtoWriteBuffer buffer) const
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_string(3, this->data);
+  buffer.check_end();
+}
+void BluetoothGATTWriteDescriptorRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_string(total_size, 3, this->data);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTWriteDescriptorRequest::dump_to(std::string &out) const {
@@ -6344,6 +7081,12 @@ void BluetoothGATTNotifyRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_bool(3, this->enable);
+  buffer.check_end();
+}
+void BluetoothGATTNotifyRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_bool(total_size, 3, this->enable);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTNotifyRequest::dump_to(std::string &out) const {
@@ -6393,6 +7136,12 @@ void BluetoothGATTNotifyDataResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_string(3, this->data);
+  buffer.check_end();
+}
+void BluetoothGATTNotifyDataResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_string(total_size, 3, this->data);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTNotifyDataResponse::dump_to(std::string &out) const {
@@ -6414,7 +7163,8 @@ void BluetoothGATTNotifyDataResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void SubscribeBluetoothConnectionsFreeRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeBluetoothConnectionsFreeRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void SubscribeBluetoothConnectionsFreeRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeBluetoothConnectionsFreeRequest::dump_to(std::string &out) const {
   out.append("SubscribeBluetoothConnectionsFreeRequest {}");
@@ -6444,6 +7194,14 @@ void BluetoothConnectionsFreeResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->allocated) {
     buffer.encode_uint64(3, it, true);
   }
+  buffer.check_end();
+}
+void BluetoothConnectionsFreeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->free);
+  ProtoSize::add_uint32(total_size, 2, this->limit);
+  for (const auto &it : this->allocated) {
+    ProtoSize::add_uint64(total_size, 3, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothConnectionsFreeResponse::dump_to(std::string &out) const {
@@ -6490,6 +7248,12 @@ void BluetoothGATTErrorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_int32(3, this->error);
+  buffer.check_end();
+}
+void BluetoothGATTErrorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
+  ProtoSize::add_int32(total_size, 3, this->error);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTErrorResponse::dump_to(std::string &out) const {
@@ -6529,6 +7293,11 @@ bool BluetoothGATTWriteResponse::decode_varint(uint32_t field_id, ProtoVarInt va
 void BluetoothGATTWriteResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
+  buffer.check_end();
+}
+void BluetoothGATTWriteResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTWriteResponse::dump_to(std::string &out) const {
@@ -6563,6 +7332,11 @@ bool BluetoothGATTNotifyResponse::decode_varint(uint32_t field_id, ProtoVarInt v
 void BluetoothGATTNotifyResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
+  buffer.check_end();
+}
+void BluetoothGATTNotifyResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_uint32(total_size, 2, this->handle);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTNotifyResponse::dump_to(std::string &out) const {
@@ -6602,6 +7376,12 @@ void BluetoothDevicePairingResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->paired);
   buffer.encode_int32(3, this->error);
+  buffer.check_end();
+}
+void BluetoothDevicePairingResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_bool(total_size, 2, this->paired);
+  ProtoSize::add_int32(total_size, 3, this->error);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDevicePairingResponse::dump_to(std::string &out) const {
@@ -6645,6 +7425,12 @@ void BluetoothDeviceUnpairingResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->success);
   buffer.encode_int32(3, this->error);
+  buffer.check_end();
+}
+void BluetoothDeviceUnpairingResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_bool(total_size, 2, this->success);
+  ProtoSize::add_int32(total_size, 3, this->error);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDeviceUnpairingResponse::dump_to(std::string &out) const {
@@ -6666,7 +7452,8 @@ void BluetoothDeviceUnpairingResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void UnsubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const {}
+void UnsubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void UnsubscribeBluetoothLEAdvertisementsRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void UnsubscribeBluetoothLEAdvertisementsRequest::dump_to(std::string &out) const {
   out.append("UnsubscribeBluetoothLEAdvertisementsRequest {}");
@@ -6694,6 +7481,12 @@ void BluetoothDeviceClearCacheResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->success);
   buffer.encode_int32(3, this->error);
+  buffer.check_end();
+}
+void BluetoothDeviceClearCacheResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint64(total_size, 1, this->address);
+  ProtoSize::add_bool(total_size, 2, this->success);
+  ProtoSize::add_int32(total_size, 3, this->error);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDeviceClearCacheResponse::dump_to(std::string &out) const {
@@ -6732,6 +7525,11 @@ bool SubscribeVoiceAssistantRequest::decode_varint(uint32_t field_id, ProtoVarIn
 void SubscribeVoiceAssistantRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->subscribe);
   buffer.encode_uint32(2, this->flags);
+  buffer.check_end();
+}
+void SubscribeVoiceAssistantRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->subscribe);
+  ProtoSize::add_uint32(total_size, 2, this->flags);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeVoiceAssistantRequest::dump_to(std::string &out) const {
@@ -6776,6 +7574,12 @@ void VoiceAssistantAudioSettings::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(1, this->noise_suppression_level);
   buffer.encode_uint32(2, this->auto_gain);
   buffer.encode_float(3, this->volume_multiplier);
+  buffer.check_end();
+}
+void VoiceAssistantAudioSettings::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->noise_suppression_level);
+  ProtoSize::add_uint32(total_size, 2, this->auto_gain);
+  ProtoSize::add_float(total_size, 3, this->volume_multiplier);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantAudioSettings::dump_to(std::string &out) const {
@@ -6836,6 +7640,14 @@ void VoiceAssistantRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(3, this->flags);
   buffer.encode_message<VoiceAssistantAudioSettings>(4, this->audio_settings);
   buffer.encode_string(5, this->wake_word_phrase);
+  buffer.check_end();
+}
+void VoiceAssistantRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->start);
+  ProtoSize::add_string(total_size, 2, this->conversation_id);
+  ProtoSize::add_uint32(total_size, 3, this->flags);
+  ProtoSize::add_message<VoiceAssistantAudioSettings>(total_size, 4, this->audio_settings);
+  ProtoSize::add_string(total_size, 5, this->wake_word_phrase);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantRequest::dump_to(std::string &out) const {
@@ -6881,6 +7693,11 @@ bool VoiceAssistantResponse::decode_varint(uint32_t field_id, ProtoVarInt value)
 void VoiceAssistantResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(1, this->port);
   buffer.encode_bool(2, this->error);
+  buffer.check_end();
+}
+void VoiceAssistantResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->port);
+  ProtoSize::add_bool(total_size, 2, this->error);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantResponse::dump_to(std::string &out) const {
@@ -6914,6 +7731,11 @@ bool VoiceAssistantEventData::decode_length(uint32_t field_id, ProtoLengthDelimi
 void VoiceAssistantEventData::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->name);
   buffer.encode_string(2, this->value);
+  buffer.check_end();
+}
+void VoiceAssistantEventData::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 2, this->value);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantEventData::dump_to(std::string &out) const {
@@ -6954,6 +7776,13 @@ void VoiceAssistantEventResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->data) {
     buffer.encode_message<VoiceAssistantEventData>(2, it, true);
   }
+  buffer.check_end();
+}
+void VoiceAssistantEventResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum<enums::VoiceAssistantEvent>(total_size, 1, this->event_type);
+  for (const auto &it : this->data) {
+    ProtoSize::add_message<VoiceAssistantEventData>(total_size, 2, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantEventResponse::dump_to(std::string &out) const {
@@ -6994,6 +7823,11 @@ bool VoiceAssistantAudio::decode_length(uint32_t field_id, ProtoLengthDelimited
 void VoiceAssistantAudio::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->data);
   buffer.encode_bool(2, this->end);
+  buffer.check_end();
+}
+void VoiceAssistantAudio::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->data);
+  ProtoSize::add_bool(total_size, 2, this->end);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantAudio::dump_to(std::string &out) const {
@@ -7052,6 +7886,15 @@ void VoiceAssistantTimerEventResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(4, this->total_seconds);
   buffer.encode_uint32(5, this->seconds_left);
   buffer.encode_bool(6, this->is_active);
+  buffer.check_end();
+}
+void VoiceAssistantTimerEventResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum<enums::VoiceAssistantTimerEvent>(total_size, 1, this->event_type);
+  ProtoSize::add_string(total_size, 2, this->timer_id);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_uint32(total_size, 4, this->total_seconds);
+  ProtoSize::add_uint32(total_size, 5, this->seconds_left);
+  ProtoSize::add_bool(total_size, 6, this->is_active);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantTimerEventResponse::dump_to(std::string &out) const {
@@ -7102,6 +7945,11 @@ bool VoiceAssistantAnnounceRequest::decode_length(uint32_t field_id, ProtoLength
 void VoiceAssistantAnnounceRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->media_id);
   buffer.encode_string(2, this->text);
+  buffer.check_end();
+}
+void VoiceAssistantAnnounceRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->media_id);
+  ProtoSize::add_string(total_size, 2, this->text);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantAnnounceRequest::dump_to(std::string &out) const {
@@ -7127,7 +7975,13 @@ bool VoiceAssistantAnnounceFinished::decode_varint(uint32_t field_id, ProtoVarIn
       return false;
   }
 }
-void VoiceAssistantAnnounceFinished::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->success); }
+void VoiceAssistantAnnounceFinished::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_bool(1, this->success);
+  buffer.check_end();
+}
+void VoiceAssistantAnnounceFinished::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->success);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantAnnounceFinished::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -7162,6 +8016,14 @@ void VoiceAssistantWakeWord::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->trained_languages) {
     buffer.encode_string(3, it, true);
   }
+  buffer.check_end();
+}
+void VoiceAssistantWakeWord::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->id);
+  ProtoSize::add_string(total_size, 2, this->wake_word);
+  for (const auto &it : this->trained_languages) {
+    ProtoSize::add_string(total_size, 3, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantWakeWord::dump_to(std::string &out) const {
@@ -7183,7 +8045,8 @@ void VoiceAssistantWakeWord::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void VoiceAssistantConfigurationRequest::encode(ProtoWriteBuffer buffer) const {}
+void VoiceAssistantConfigurationRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void VoiceAssistantConfigurationRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantConfigurationRequest::dump_to(std::string &out) const {
   out.append("VoiceAssistantConfigurationRequest {}");
@@ -7221,6 +8084,16 @@ void VoiceAssistantConfigurationResponse::encode(ProtoWriteBuffer buffer) const
     buffer.encode_string(2, it, true);
   }
   buffer.encode_uint32(3, this->max_active_wake_words);
+  buffer.check_end();
+}
+void VoiceAssistantConfigurationResponse::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->available_wake_words) {
+    ProtoSize::add_message<VoiceAssistantWakeWord>(total_size, 1, it, true);
+  }
+  for (const auto &it : this->active_wake_words) {
+    ProtoSize::add_string(total_size, 2, it, true);
+  }
+  ProtoSize::add_uint32(total_size, 3, this->max_active_wake_words);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantConfigurationResponse::dump_to(std::string &out) const {
@@ -7259,6 +8132,12 @@ void VoiceAssistantSetConfiguration::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->active_wake_words) {
     buffer.encode_string(1, it, true);
   }
+  buffer.check_end();
+}
+void VoiceAssistantSetConfiguration::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->active_wake_words) {
+    ProtoSize::add_string(total_size, 1, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void VoiceAssistantSetConfiguration::dump_to(std::string &out) const {
@@ -7341,6 +8220,19 @@ void ListEntitiesAlarmControlPanelResponse::encode(ProtoWriteBuffer buffer) cons
   buffer.encode_uint32(8, this->supported_features);
   buffer.encode_bool(9, this->requires_code);
   buffer.encode_bool(10, this->requires_code_to_arm);
+  buffer.check_end();
+}
+void ListEntitiesAlarmControlPanelResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_uint32(total_size, 8, this->supported_features);
+  ProtoSize::add_bool(total_size, 9, this->requires_code);
+  ProtoSize::add_bool(total_size, 10, this->requires_code_to_arm);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesAlarmControlPanelResponse::dump_to(std::string &out) const {
@@ -7413,6 +8305,11 @@ bool AlarmControlPanelStateResponse::decode_32bit(uint32_t field_id, Proto32Bit
 void AlarmControlPanelStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_enum<enums::AlarmControlPanelState>(2, this->state);
+  buffer.check_end();
+}
+void AlarmControlPanelStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::AlarmControlPanelState>(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void AlarmControlPanelStateResponse::dump_to(std::string &out) const {
@@ -7463,6 +8360,12 @@ void AlarmControlPanelCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_enum<enums::AlarmControlPanelStateCommand>(2, this->command);
   buffer.encode_string(3, this->code);
+  buffer.check_end();
+}
+void AlarmControlPanelCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::AlarmControlPanelStateCommand>(total_size, 2, this->command);
+  ProtoSize::add_string(total_size, 3, this->code);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void AlarmControlPanelCommandRequest::dump_to(std::string &out) const {
@@ -7557,6 +8460,20 @@ void ListEntitiesTextResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(9, this->max_length);
   buffer.encode_string(10, this->pattern);
   buffer.encode_enum<enums::TextMode>(11, this->mode);
+  buffer.check_end();
+}
+void ListEntitiesTextResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_uint32(total_size, 8, this->min_length);
+  ProtoSize::add_uint32(total_size, 9, this->max_length);
+  ProtoSize::add_string(total_size, 10, this->pattern);
+  ProtoSize::add_enum<enums::TextMode>(total_size, 11, this->mode);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesTextResponse::dump_to(std::string &out) const {
@@ -7645,6 +8562,12 @@ void TextStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
+  buffer.check_end();
+}
+void TextStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->state);
+  ProtoSize::add_bool(total_size, 3, this->missing_state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TextStateResponse::dump_to(std::string &out) const {
@@ -7688,6 +8611,11 @@ bool TextCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void TextCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
+  buffer.check_end();
+}
+void TextCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->state);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TextCommandRequest::dump_to(std::string &out) const {
@@ -7758,6 +8686,16 @@ void ListEntitiesDateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->icon);
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesDateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesDateResponse::dump_to(std::string &out) const {
@@ -7832,6 +8770,14 @@ void DateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(3, this->year);
   buffer.encode_uint32(4, this->month);
   buffer.encode_uint32(5, this->day);
+  buffer.check_end();
+}
+void DateStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->missing_state);
+  ProtoSize::add_uint32(total_size, 3, this->year);
+  ProtoSize::add_uint32(total_size, 4, this->month);
+  ProtoSize::add_uint32(total_size, 5, this->day);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DateStateResponse::dump_to(std::string &out) const {
@@ -7896,6 +8842,13 @@ void DateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->year);
   buffer.encode_uint32(3, this->month);
   buffer.encode_uint32(4, this->day);
+  buffer.check_end();
+}
+void DateCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_uint32(total_size, 2, this->year);
+  ProtoSize::add_uint32(total_size, 3, this->month);
+  ProtoSize::add_uint32(total_size, 4, this->day);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DateCommandRequest::dump_to(std::string &out) const {
@@ -7977,6 +8930,16 @@ void ListEntitiesTimeResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->icon);
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesTimeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesTimeResponse::dump_to(std::string &out) const {
@@ -8051,6 +9014,14 @@ void TimeStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(3, this->hour);
   buffer.encode_uint32(4, this->minute);
   buffer.encode_uint32(5, this->second);
+  buffer.check_end();
+}
+void TimeStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->missing_state);
+  ProtoSize::add_uint32(total_size, 3, this->hour);
+  ProtoSize::add_uint32(total_size, 4, this->minute);
+  ProtoSize::add_uint32(total_size, 5, this->second);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TimeStateResponse::dump_to(std::string &out) const {
@@ -8115,6 +9086,13 @@ void TimeCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->hour);
   buffer.encode_uint32(3, this->minute);
   buffer.encode_uint32(4, this->second);
+  buffer.check_end();
+}
+void TimeCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_uint32(total_size, 2, this->hour);
+  ProtoSize::add_uint32(total_size, 3, this->minute);
+  ProtoSize::add_uint32(total_size, 4, this->second);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TimeCommandRequest::dump_to(std::string &out) const {
@@ -8208,6 +9186,20 @@ void ListEntitiesEventResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->event_types) {
     buffer.encode_string(9, it, true);
   }
+  buffer.check_end();
+}
+void ListEntitiesEventResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_string(total_size, 8, this->device_class);
+  for (const auto &it : this->event_types) {
+    ProtoSize::add_string(total_size, 9, it, true);
+  }
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesEventResponse::dump_to(std::string &out) const {
@@ -8277,6 +9269,11 @@ bool EventResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void EventResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->event_type);
+  buffer.check_end();
+}
+void EventResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 2, this->event_type);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void EventResponse::dump_to(std::string &out) const {
@@ -8367,6 +9364,20 @@ void ListEntitiesValveResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(9, this->assumed_state);
   buffer.encode_bool(10, this->supports_position);
   buffer.encode_bool(11, this->supports_stop);
+  buffer.check_end();
+}
+void ListEntitiesValveResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_string(total_size, 8, this->device_class);
+  ProtoSize::add_bool(total_size, 9, this->assumed_state);
+  ProtoSize::add_bool(total_size, 10, this->supports_position);
+  ProtoSize::add_bool(total_size, 11, this->supports_stop);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesValveResponse::dump_to(std::string &out) const {
@@ -8447,6 +9458,12 @@ void ValveStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->position);
   buffer.encode_enum<enums::ValveOperation>(3, this->current_operation);
+  buffer.check_end();
+}
+void ValveStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 2, this->position);
+  ProtoSize::add_enum<enums::ValveOperation>(total_size, 3, this->current_operation);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ValveStateResponse::dump_to(std::string &out) const {
@@ -8501,6 +9518,13 @@ void ValveCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(2, this->has_position);
   buffer.encode_float(3, this->position);
   buffer.encode_bool(4, this->stop);
+  buffer.check_end();
+}
+void ValveCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->has_position);
+  ProtoSize::add_float(total_size, 3, this->position);
+  ProtoSize::add_bool(total_size, 4, this->stop);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ValveCommandRequest::dump_to(std::string &out) const {
@@ -8580,6 +9604,16 @@ void ListEntitiesDateTimeResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->icon);
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
+  buffer.check_end();
+}
+void ListEntitiesDateTimeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesDateTimeResponse::dump_to(std::string &out) const {
@@ -8644,6 +9678,12 @@ void DateTimeStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->missing_state);
   buffer.encode_fixed32(3, this->epoch_seconds);
+  buffer.check_end();
+}
+void DateTimeStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->missing_state);
+  ProtoSize::add_fixed32(total_size, 3, this->epoch_seconds);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DateTimeStateResponse::dump_to(std::string &out) const {
@@ -8682,6 +9722,11 @@ bool DateTimeCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void DateTimeCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_fixed32(2, this->epoch_seconds);
+  buffer.check_end();
+}
+void DateTimeCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_fixed32(total_size, 2, this->epoch_seconds);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DateTimeCommandRequest::dump_to(std::string &out) const {
@@ -8758,6 +9803,17 @@ void ListEntitiesUpdateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_string(8, this->device_class);
+  buffer.check_end();
+}
+void ListEntitiesUpdateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 2, this->key);
+  ProtoSize::add_string(total_size, 3, this->name);
+  ProtoSize::add_string(total_size, 4, this->unique_id);
+  ProtoSize::add_string(total_size, 5, this->icon);
+  ProtoSize::add_bool(total_size, 6, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 7, this->entity_category);
+  ProtoSize::add_string(total_size, 8, this->device_class);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesUpdateResponse::dump_to(std::string &out) const {
@@ -8867,6 +9923,19 @@ void UpdateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(8, this->title);
   buffer.encode_string(9, this->release_summary);
   buffer.encode_string(10, this->release_url);
+  buffer.check_end();
+}
+void UpdateStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 2, this->missing_state);
+  ProtoSize::add_bool(total_size, 3, this->in_progress);
+  ProtoSize::add_bool(total_size, 4, this->has_progress);
+  ProtoSize::add_float(total_size, 5, this->progress);
+  ProtoSize::add_string(total_size, 6, this->current_version);
+  ProtoSize::add_string(total_size, 7, this->latest_version);
+  ProtoSize::add_string(total_size, 8, this->title);
+  ProtoSize::add_string(total_size, 9, this->release_summary);
+  ProtoSize::add_string(total_size, 10, this->release_url);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void UpdateStateResponse::dump_to(std::string &out) const {
@@ -8939,6 +10008,11 @@ bool UpdateCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 void UpdateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_enum<enums::UpdateCommand>(2, this->command);
+  buffer.check_end();
+}
+void UpdateCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::UpdateCommand>(total_size, 2, this->command);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void UpdateCommandRequest::dump_to(std::string &out) const {
@@ -8955,6 +10029,325 @@ void UpdateCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+void GetProfileRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void GetProfileRequest::calculate_size(uint32_t &total_size) const {}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void GetProfileRequest::dump_to(std::string &out) const { out.append("GetProfileRequest {}"); }
+#endif
+bool ProfileComponentStats::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->loop_count = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->loop_total_us = value.as_uint32();
+      return true;
+    }
+    case 4: {
+      this->loop_max_us = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->loop_p99_us = value.as_uint32();
+      return true;
+    }
+    case 6: {
+      this->scheduler_count = value.as_uint32();
+      return true;
+    }
+    case 7: {
+      this->scheduler_total_us = value.as_uint32();
+      return true;
+    }
+    case 8: {
+      this->scheduler_max_us = value.as_uint32();
+      return true;
+    }
+    case 9: {
+      this->scheduler_p99_us = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool ProfileComponentStats::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->source = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ProfileComponentStats::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_string(1, this->source);
+  buffer.encode_uint32(2, this->loop_count);
+  buffer.encode_uint32(3, this->loop_total_us);
+  buffer.encode_uint32(4, this->loop_max_us);
+  buffer.encode_uint32(5, this->loop_p99_us);
+  buffer.encode_uint32(6, this->scheduler_count);
+  buffer.encode_uint32(7, this->scheduler_total_us);
+  buffer.encode_uint32(8, this->scheduler_max_us);
+  buffer.encode_uint32(9, this->scheduler_p99_us);
+  buffer.check_end();
+}
+void ProfileComponentStats::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->source);
+  ProtoSize::add_uint32(total_size, 2, this->loop_count);
+  ProtoSize::add_uint32(total_size, 3, this->loop_total_us);
+  ProtoSize::add_uint32(total_size, 4, this->loop_max_us);
+  ProtoSize::add_uint32(total_size, 5, this->loop_p99_us);
+  ProtoSize::add_uint32(total_size, 6, this->scheduler_count);
+  ProtoSize::add_uint32(total_size, 7, this->scheduler_total_us);
+  ProtoSize::add_uint32(total_size, 8, this->scheduler_max_us);
+  ProtoSize::add_uint32(total_size, 9, this->scheduler_p99_us);
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void ProfileComponentStats::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("ProfileComponentStats {\n");
+  out.append("  source: ");
+  out.append("'").append(this->source).append("'");
+  out.append("\n");
+
+  out.append("  loop_count: ");
+  sprintf(buffer, "%" PRIu32, this->loop_count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_total_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_total_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_max_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_p99_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_p99_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  scheduler_count: ");
+  sprintf(buffer, "%" PRIu32, this->scheduler_count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  scheduler_total_us: ");
+  sprintf(buffer, "%" PRIu32, this->scheduler_total_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  scheduler_max_us: ");
+  sprintf(buffer, "%" PRIu32, this->scheduler_max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  scheduler_p99_us: ");
+  sprintf(buffer, "%" PRIu32, this->scheduler_p99_us);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+#endif
+bool GetProfileResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->window_ms = value.as_uint32();
+      return true;
+    }
+    case 2: {
+      this->loop_time_max_us = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->loop_time_p99_us = value.as_uint32();
+      return true;
+    }
+    case 4: {
+      this->loop_jitter_max_us = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->loop_jitter_p99_us = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool GetProfileResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 6: {
+      this->components.push_back(value.as_message<ProfileComponentStats>());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void GetProfileResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, this->window_ms);
+  buffer.encode_uint32(2, this->loop_time_max_us);
+  buffer.encode_uint32(3, this->loop_time_p99_us);
+  buffer.encode_uint32(4, this->loop_jitter_max_us);
+  buffer.encode_uint32(5, this->loop_jitter_p99_us);
+  for (auto &it : this->components) {
+    buffer.encode_message<ProfileComponentStats>(6, it, true);
+  }
+  buffer.check_end();
+}
+void GetProfileResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->window_ms);
+  ProtoSize::add_uint32(total_size, 2, this->loop_time_max_us);
+  ProtoSize::add_uint32(total_size, 3, this->loop_time_p99_us);
+  ProtoSize::add_uint32(total_size, 4, this->loop_jitter_max_us);
+  ProtoSize::add_uint32(total_size, 5, this->loop_jitter_p99_us);
+  for (const auto &it : this->components) {
+    ProtoSize::add_message<ProfileComponentStats>(total_size, 6, it, true);
+  }
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void GetProfileResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("GetProfileResponse {\n");
+  out.append("  window_ms: ");
+  sprintf(buffer, "%" PRIu32, this->window_ms);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_time_max_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_time_max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_time_p99_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_time_p99_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_jitter_max_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_jitter_max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_jitter_p99_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_jitter_p99_us);
+  out.append(buffer);
+  out.append("\n");
+
+  for (const auto &it : this->components) {
+    out.append("  components: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+  out.append("}");
+}
+#endif
+void ConnectionStatsRequest::encode(ProtoWriteBuffer buffer) const { buffer.check_end(); }
+void ConnectionStatsRequest::calculate_size(uint32_t &total_size) const {}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void ConnectionStatsRequest::dump_to(std::string &out) const { out.append("ConnectionStatsRequest {}"); }
+#endif
+bool ConnectionStatsResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->send_queue_bytes = value.as_uint32();
+      return true;
+    }
+    case 2: {
+      this->send_queue_peak_bytes = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->send_queue_limit = value.as_uint32();
+      return true;
+    }
+    case 4: {
+      this->messages_dropped = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->bytes_dropped = value.as_uint32();
+      return true;
+    }
+    case 6: {
+      this->state_updates_coalesced = value.as_uint32();
+      return true;
+    }
+    case 7: {
+      this->state_updates_flushed = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ConnectionStatsResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, this->send_queue_bytes);
+  buffer.encode_uint32(2, this->send_queue_peak_bytes);
+  buffer.encode_uint32(3, this->send_queue_limit);
+  buffer.encode_uint32(4, this->messages_dropped);
+  buffer.encode_uint32(5, this->bytes_dropped);
+  buffer.encode_uint32(6, this->state_updates_coalesced);
+  buffer.encode_uint32(7, this->state_updates_flushed);
+  buffer.check_end();
+}
+void ConnectionStatsResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->send_queue_bytes);
+  ProtoSize::add_uint32(total_size, 2, this->send_queue_peak_bytes);
+  ProtoSize::add_uint32(total_size, 3, this->send_queue_limit);
+  ProtoSize::add_uint32(total_size, 4, this->messages_dropped);
+  ProtoSize::add_uint32(total_size, 5, this->bytes_dropped);
+  ProtoSize::add_uint32(total_size, 6, this->state_updates_coalesced);
+  ProtoSize::add_uint32(total_size, 7, this->state_updates_flushed);
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void ConnectionStatsResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("ConnectionStatsResponse {\n");
+  out.append("  send_queue_bytes: ");
+  sprintf(buffer, "%" PRIu32, this->send_queue_bytes);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  send_queue_peak_bytes: ");
+  sprintf(buffer, "%" PRIu32, this->send_queue_peak_bytes);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  send_queue_limit: ");
+  sprintf(buffer, "%" PRIu32, this->send_queue_limit);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  messages_dropped: ");
+  sprintf(buffer, "%" PRIu32, this->messages_dropped);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  bytes_dropped: ");
+  sprintf(buffer, "%" PRIu32, this->bytes_dropped);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  state_updates_coalesced: ");
+  sprintf(buffer, "%" PRIu32, this->state_updates_coalesced);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  state_updates_flushed: ");
+  sprintf(buffer, "%" PRIu32, this->state_updates_flushed);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
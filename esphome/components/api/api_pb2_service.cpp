@@ -652,6 +652,22 @@ bool APIServerConnectionBase::send_update_state_response(const UpdateStateRespon
 #endif
 #ifdef USE_UPDATE
 #endif
+#ifdef USE_PROFILER
+#endif
+#ifdef USE_PROFILER
+bool APIServerConnectionBase::send_get_profile_response(const GetProfileResponse &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_get_profile_response: %s", msg.dump().c_str());
+#endif
+  return this->send_message_<GetProfileResponse>(msg, 125);
+}
+#endif
+bool APIServerConnectionBase::send_connection_stats_response(const ConnectionStatsResponse &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_connection_stats_response: %s", msg.dump().c_str());
+#endif
+  return this->send_message_<ConnectionStatsResponse>(msg, 127);
+}
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -1194,6 +1210,26 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
 #endif
       break;
     }
+    case 124: {
+#ifdef USE_PROFILER
+      GetProfileRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_get_profile_request: %s", msg.dump().c_str());
+#endif
+      this->on_get_profile_request(msg);
+#endif
+      break;
+    }
+    case 126: {
+      ConnectionStatsRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_connection_stats_request: %s", msg.dump().c_str());
+#endif
+      this->on_connection_stats_request(msg);
+      break;
+    }
     default:
       return false;
   }
@@ -1723,6 +1759,36 @@ void APIServerConnection::on_alarm_control_panel_command_request(const AlarmCont
   this->alarm_control_panel_command(msg);
 }
 #endif
+#ifdef USE_PROFILER
+void APIServerConnection::on_get_profile_request(const GetProfileRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  GetProfileResponse ret = this->get_profile(msg);
+  if (!this->send_get_profile_response(ret)) {
+    this->on_fatal_error();
+  }
+}
+#endif
+void APIServerConnection::on_connection_stats_request(const ConnectionStatsRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  ConnectionStatsResponse ret = this->connection_stats(msg);
+  if (!this->send_connection_stats_response(ret)) {
+    this->on_fatal_error();
+  }
+}
 
 }  // namespace api
 }  // namespace esphome
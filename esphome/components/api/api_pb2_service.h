@@ -331,6 +331,14 @@ class APIServerConnectionBase : public ProtoService {
 #ifdef USE_UPDATE
   virtual void on_update_command_request(const UpdateCommandRequest &value){};
 #endif
+#ifdef USE_PROFILER
+  virtual void on_get_profile_request(const GetProfileRequest &value){};
+#endif
+#ifdef USE_PROFILER
+  bool send_get_profile_response(const GetProfileResponse &msg);
+#endif
+  virtual void on_connection_stats_request(const ConnectionStatsRequest &value){};
+  bool send_connection_stats_response(const ConnectionStatsResponse &msg);
  protected:
   bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
 };
@@ -444,6 +452,10 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_ALARM_CONTROL_PANEL
   virtual void alarm_control_panel_command(const AlarmControlPanelCommandRequest &msg) = 0;
 #endif
+#ifdef USE_PROFILER
+  virtual GetProfileResponse get_profile(const GetProfileRequest &msg) = 0;
+#endif
+  virtual ConnectionStatsResponse connection_stats(const ConnectionStatsRequest &msg) = 0;
  protected:
   void on_hello_request(const HelloRequest &msg) override;
   void on_connect_request(const ConnectRequest &msg) override;
@@ -551,6 +563,10 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_ALARM_CONTROL_PANEL
   void on_alarm_control_panel_command_request(const AlarmControlPanelCommandRequest &msg) override;
 #endif
+#ifdef USE_PROFILER
+  void on_get_profile_request(const GetProfileRequest &msg) override;
+#endif
+  void on_connection_stats_request(const ConnectionStatsRequest &msg) override;
 };
 
 }  // namespace api
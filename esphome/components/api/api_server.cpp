@@ -1,6 +1,7 @@
 #include "api_server.h"
 #ifdef USE_API
 #include <cerrno>
+#include <cinttypes>
 #include "api_connection.h"
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -20,12 +21,14 @@ namespace esphome {
 namespace api {
 
 static const char *const TAG = "api";
+/// How often the listening socket is checked for new clients while none are connected and the loop is disabled.
+static const uint32_t API_IDLE_POLL_INTERVAL = 50;
 
 // APIServer
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
   this->setup_controller();
-  socket_ = socket::socket_ip(SOCK_STREAM, 0);
+  socket_ = socket::socket_ip_loop_monitored(SOCK_STREAM, 0);  // monitored for incoming connections
   if (socket_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -92,9 +95,20 @@ void APIServer::setup() {
   }
 #endif
 }
-void APIServer::loop() {
-  // Accept new clients
-  while (true) {
+const PacketInfo *EncodedStateCache::find(EntityBase *entity, size_t index) const {
+  if (index < this->entries_.size() && this->entries_[index].entity == entity)
+    return &this->entries_[index].packet;
+  return nullptr;
+}
+void EncodedStateCache::add(EntityBase *entity, size_t index, const PacketInfo &packet) {
+  if (index >= this->entries_.size())
+    this->entries_.resize(index + 1, Entry{nullptr, {}});
+  this->entries_[index] = {entity, packet};
+}
+
+bool APIServer::accept_new_clients_() {
+  bool accepted = false;
+  while (this->socket_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     auto sock = socket_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -105,7 +119,35 @@ void APIServer::loop() {
     auto *conn = new APIConnection(std::move(sock), this);
     clients_.emplace_back(conn);
     conn->start();
+    accepted = true;
+  }
+  return accepted;
+}
+void APIServer::check_reboot_timeout_() {
+  if (this->reboot_timeout_ == 0)
+    return;
+  const uint32_t now = millis();
+  if (!this->is_connected()) {
+    if (now - this->last_connected_ > this->reboot_timeout_) {
+      ESP_LOGE(TAG, "No client connected to API. Rebooting...");
+      App.reboot();
+    }
+    this->status_set_warning();
+  } else {
+    this->last_connected_ = now;
+    this->status_clear_warning();
+  }
+}
+void APIServer::poll_idle_() {
+  if (this->accept_new_clients_()) {
+    this->cancel_interval("idle");
+    this->enable_loop();
+    return;
   }
+  this->check_reboot_timeout_();
+}
+void APIServer::loop() {
+  this->accept_new_clients_();
 
   // Partition clients into remove and active
   auto new_end = std::partition(this->clients_.begin(), this->clients_.end(),
@@ -113,32 +155,47 @@ void APIServer::loop() {
   // print disconnection messages
   for (auto it = new_end; it != this->clients_.end(); ++it) {
     this->client_disconnected_trigger_->trigger((*it)->client_info_, (*it)->client_peername_);
-    ESP_LOGV(TAG, "Removing connection to %s", (*it)->client_info_.c_str());
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+    const APIFrameTxQueue &tx_queue = (*it)->helper_->get_tx_queue();
+    ESP_LOGV(TAG,
+             "Removing connection to %s (%" PRIu32 " state updates sent, %" PRIu32 " coalesced; send queue peak %u "
+             "bytes, %" PRIu32 " messages dropped)",
+             (*it)->client_info_.c_str(), (*it)->state_updates_flushed_, (*it)->state_updates_coalesced_,
+             (unsigned) tx_queue.get_peak_size(), tx_queue.get_dropped_messages());
+#endif
   }
   // resize vector
   this->clients_.erase(new_end, this->clients_.end());
 
+  if (this->clients_.empty()) {
+    // Nothing to do until a client connects, stop looping and only poll the listening socket
+    this->disable_loop();
+    this->set_interval("idle", API_IDLE_POLL_INTERVAL, [this]() { this->poll_idle_(); });
+    this->check_reboot_timeout_();
+    return;
+  }
+
   for (auto &client : this->clients_) {
     client->loop();
   }
-
-  if (this->reboot_timeout_ != 0) {
-    const uint32_t now = millis();
-    if (!this->is_connected()) {
-      if (now - this->last_connected_ > this->reboot_timeout_) {
-        ESP_LOGE(TAG, "No client connected to API. Rebooting...");
-        App.reboot();
-      }
-      this->status_set_warning();
-    } else {
-      this->last_connected_ = now;
-      this->status_clear_warning();
-    }
+  // Flush only after all connections have handled their messages: no state can change while flushing, so a state
+  // message encoded for one connection is valid for all of them
+  for (auto &client : this->clients_) {
+    client->flush_due_state_updates();
   }
+  this->encoded_state_cache_.clear();
+
+  this->check_reboot_timeout_();
 }
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Batch delay: %" PRIu32 " ms", this->batch_delay_);
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  ESP_LOGCONFIG(TAG, "  Entity list cache: enabled");
+#endif
+  ESP_LOGCONFIG(TAG, "  Send queue limit: %" PRIu32 " bytes (%s when full)", this->send_queue_limit_,
+                this->send_queue_overflow_ == SEND_QUEUE_OVERFLOW_DISCONNECT ? "disconnect" : "drop");
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -19,6 +19,46 @@
 namespace esphome {
 namespace api {
 
+/// What happens when a message would make the send queue of a connection exceed its limit.
+enum SendQueueOverflow : uint8_t {
+  /// Don't send the message, state updates are kept and sent once there's room.
+  SEND_QUEUE_OVERFLOW_DROP = 0,
+  /// Disconnect the client, it can't keep up.
+  SEND_QUEUE_OVERFLOW_DISCONNECT = 1,
+};
+
+/** State messages encoded by one connection, so that the other connections send the same update without encoding it.
+ *
+ * Only filled while the connections flush their state updates one after another in APIServer::loop(). Nothing can
+ * change the state of an entity during that pass, so a message is valid for all connections; it is cleared after.
+ * The connections encode their batches straight into get_buffer(), and write shared messages from there.
+ */
+class EncodedStateCache {
+ public:
+  /** Find the message encoded for the update of an entity at position index in the queue of a connection.
+   *
+   * The server notifies all connections of a state change one after another, so they queue their updates in the same
+   * order and messages are looked up by position. An update queued at another position is encoded again.
+   */
+  const PacketInfo *find(EntityBase *entity, size_t index) const;
+  /// Remember the message of an update, packet is its location in get_buffer().
+  void add(EntityBase *entity, size_t index, const PacketInfo &packet);
+  std::vector<uint8_t> &get_buffer() { return this->data_; }
+  /// Forget the messages, keeping the allocated buffers.
+  void clear() {
+    this->entries_.clear();
+    this->data_.clear();
+  }
+
+ protected:
+  struct Entry {
+    EntityBase *entity;
+    PacketInfo packet;
+  };
+  std::vector<Entry> entries_;
+  std::vector<uint8_t> data_;
+};
+
 class APIServer : public Component, public Controller {
  public:
   APIServer();
@@ -33,6 +73,16 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  void set_batch_delay(uint32_t batch_delay) { this->batch_delay_ = batch_delay; }
+  /// How long state updates are collected before they are sent as one batch, 0 sends them in the next loop.
+  uint32_t get_batch_delay() const { return this->batch_delay_; }
+  void set_send_queue_limit(uint32_t send_queue_limit) { this->send_queue_limit_ = send_queue_limit; }
+  /// Bytes that may be queued per connection while the client doesn't read fast enough, 0 for no limit.
+  uint32_t get_send_queue_limit() const { return this->send_queue_limit_; }
+  void set_send_queue_overflow(SendQueueOverflow send_queue_overflow) {
+    this->send_queue_overflow_ = send_queue_overflow;
+  }
+  SendQueueOverflow get_send_queue_overflow() const { return this->send_queue_overflow_; }
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -122,6 +172,13 @@ class APIServer : public Component, public Controller {
                                 std::function<void(std::string)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  ListEntitiesCache &get_list_entities_cache() { return this->list_entities_cache_; }
+#endif
+  /// The state messages encoded so far in this flush pass, nullptr if there's only one connection to share them with.
+  EncodedStateCache *get_encoded_state_cache() {
+    return this->clients_.size() > 1 ? &this->encoded_state_cache_ : nullptr;
+  }
 
   Trigger<std::string, std::string> *get_client_connected_trigger() const { return this->client_connected_trigger_; }
   Trigger<std::string, std::string> *get_client_disconnected_trigger() const {
@@ -129,14 +186,27 @@ class APIServer : public Component, public Controller {
   }
 
  protected:
+  /// Accept all pending connections, returns whether there was at least one.
+  bool accept_new_clients_();
+  void check_reboot_timeout_();
+  /// Called from an interval while no client is connected, resumes the loop once one connects.
+  void poll_idle_();
+
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  uint32_t batch_delay_{0};
+  uint32_t send_queue_limit_{8000};
+  SendQueueOverflow send_queue_overflow_{SEND_QUEUE_OVERFLOW_DROP};
   uint32_t last_connected_{0};
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
   std::vector<UserServiceDescriptor *> user_services_;
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  ListEntitiesCache list_entities_cache_;
+#endif
+  EncodedStateCache encoded_state_cache_;
   Trigger<std::string, std::string> *client_connected_trigger_ = new Trigger<std::string, std::string>();
   Trigger<std::string, std::string> *client_disconnected_trigger_ = new Trigger<std::string, std::string>();
 
@@ -43,6 +43,25 @@ bool ListEntitiesIterator::on_lock(lock::Lock *a_lock) { return this->client_->s
 bool ListEntitiesIterator::on_valve(valve::Valve *valve) { return this->client_->send_valve_info(valve); }
 #endif
 
+#ifdef USE_API_LIST_ENTITIES_CACHE
+void ListEntitiesCache::invalidate() {
+  this->generation_++;
+  if (!this->valid_)
+    return;
+  this->valid_ = false;
+  // Free the memory, the size of the next encoding isn't known anyway
+  std::vector<uint8_t>().swap(this->data_);
+  std::vector<PacketInfo>().swap(this->packets_);
+}
+void ListEntitiesCache::set(std::vector<uint8_t> &&data, std::vector<PacketInfo> &&packets) {
+  this->data_ = std::move(data);
+  this->data_.shrink_to_fit();
+  this->packets_ = std::move(packets);
+  this->packets_.shrink_to_fit();
+  this->valid_ = true;
+}
+#endif
+
 bool ListEntitiesIterator::on_end() { return this->client_->send_list_info_done(); }
 ListEntitiesIterator::ListEntitiesIterator(APIConnection *client) : client_(client) {}
 bool ListEntitiesIterator::on_service(UserServiceDescriptor *service) {
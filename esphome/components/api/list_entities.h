@@ -2,13 +2,47 @@
 
 #include "esphome/core/defines.h"
 #ifdef USE_API
+#include "api_frame_helper.h"
 #include "esphome/core/component.h"
 #include "esphome/core/component_iterator.h"
+
+#include <vector>
+
 namespace esphome {
 namespace api {
 
 class APIConnection;
 
+#ifdef USE_API_LIST_ENTITIES_CACHE
+/** The ListEntities responses of all entities, encoded once and shared by all connections.
+ *
+ * Entity metadata rarely changes after setup, so instead of encoding a response per entity for every client that
+ * connects, the messages are encoded once into a single buffer, and the connections write them from there straight to
+ * their frame helper. The EntityBase setters invalidate the cache, code that changes other metadata at runtime, like
+ * the traits of an entity, must call invalidate() itself.
+ */
+class ListEntitiesCache {
+ public:
+  bool is_valid() const { return this->valid_; }
+  /// Discard the messages, they are encoded again when the next client lists the entities.
+  void invalidate();
+  /// Incremented by invalidate(), so that an encoding started before can be discarded.
+  uint32_t get_generation() const { return this->generation_; }
+  void set(std::vector<uint8_t> &&data, std::vector<PacketInfo> &&packets);
+
+  /// The encoded messages, one after another.
+  const std::vector<uint8_t> &get_data() const { return this->data_; }
+  /// Type and location in get_data() of each message, ending with ListEntitiesDoneResponse.
+  const std::vector<PacketInfo> &get_packets() const { return this->packets_; }
+
+ protected:
+  std::vector<uint8_t> data_;
+  std::vector<PacketInfo> packets_;
+  uint32_t generation_{0};
+  bool valid_{false};
+};
+#endif
+
 class ListEntitiesIterator : public ComponentIterator {
  public:
   ListEntitiesIterator(APIConnection *client);
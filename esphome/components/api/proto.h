@@ -4,12 +4,21 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <cstring>
+#include <string>
 #include <vector>
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
 #define HAS_PROTO_MESSAGE_DUMP
 #endif
 
+// Check that every message encodes to exactly the size calculate_size() reported
+// #define ESPHOME_DEBUG_API
+
+#ifdef ESPHOME_DEBUG_API
+#include <cassert>
+#endif
+
 namespace esphome {
 namespace api {
 
@@ -143,12 +152,140 @@ class Proto64Bit {
   const uint64_t value_;
 };
 
+/** Computes the encoded size of fields, so that the buffer can be sized before a message is encoded.
+ *
+ * Every add_* method mirrors the encode_* method of ProtoWriteBuffer with the same name, including which default
+ * values are skipped. The generated calculate_size() of a message calls them for each field.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < (1 << 7))
+      return 1;
+    if (value < (1 << 14))
+      return 2;
+    if (value < (1 << 21))
+      return 3;
+    if (value < (1 << 28))
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    uint32_t size = 1;
+    while (value > 0x7F) {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+  static uint32_t field(uint32_t field_id, uint32_t type) { return varint((field_id << 3) | (type & 0b111)); }
+
+  static void add_length(uint32_t &total_size, uint32_t field_id, size_t len, bool force = false) {
+    if (len == 0 && !force)
+      return;
+    total_size += field(field_id, 2) + varint(static_cast<uint32_t>(len)) + len;
+  }
+  static void add_string(uint32_t &total_size, uint32_t field_id, const std::string &value, bool force = false) {
+    add_length(total_size, field_id, value.size(), force);
+  }
+  static void add_uint32(uint32_t &total_size, uint32_t field_id, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field(field_id, 0) + varint(value);
+  }
+  static void add_uint64(uint32_t &total_size, uint32_t field_id, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field(field_id, 0) + varint(value);
+  }
+  static void add_bool(uint32_t &total_size, uint32_t field_id, bool value, bool force = false) {
+    if (!value && !force)
+      return;
+    total_size += field(field_id, 0) + 1;
+  }
+  static void add_fixed32(uint32_t &total_size, uint32_t field_id, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field(field_id, 5) + 4;
+  }
+  static void add_fixed64(uint32_t &total_size, uint32_t field_id, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field(field_id, 1) + 8;
+  }
+  template<typename T> static void add_enum(uint32_t &total_size, uint32_t field_id, T value, bool force = false) {
+    add_uint32(total_size, field_id, static_cast<uint32_t>(value), force);
+  }
+  static void add_float(uint32_t &total_size, uint32_t field_id, float value, bool force = false) {
+    if (value == 0.0f && !force)
+      return;
+    total_size += field(field_id, 5) + 4;
+  }
+  static void add_int32(uint32_t &total_size, uint32_t field_id, int32_t value, bool force = false) {
+    if (value < 0) {
+      // negative int32 is always 10 byte long
+      add_int64(total_size, field_id, value, force);
+      return;
+    }
+    add_uint32(total_size, field_id, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64(uint32_t &total_size, uint32_t field_id, int64_t value, bool force = false) {
+    add_uint64(total_size, field_id, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32(uint32_t &total_size, uint32_t field_id, int32_t value, bool force = false) {
+    add_uint32(total_size, field_id, zigzag(value), force);
+  }
+  static void add_sint64(uint32_t &total_size, uint32_t field_id, int64_t value, bool force = false) {
+    add_uint64(total_size, field_id, zigzag(value), force);
+  }
+  template<class C>
+  static void add_message(uint32_t &total_size, uint32_t field_id, const C &value, bool force = false) {
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    total_size += field(field_id, 2) + varint(nested_length) + nested_length;
+  }
+
+  static uint32_t zigzag(int32_t value) {
+    if (value < 0)
+      return ~(value << 1);
+    return value << 1;
+  }
+  static uint64_t zigzag(int64_t value) {
+    if (value < 0)
+      return ~(value << 1);
+    return value << 1;
+  }
+};
+
+/** Encodes fields into a buffer that was sized with ProtoSize beforehand.
+ *
+ * Writes go straight through a raw pointer without bounds checks or reallocation, so the space has to be reserved
+ * up front: ProtoService::send_message_() sizes the buffer with the message's calculate_size(), code that encodes
+ * fields by hand has to pass the size computed with the matching ProtoSize methods to create_buffer() and call
+ * check_end() once all fields are written.
+ */
 class ProtoWriteBuffer {
  public:
-  ProtoWriteBuffer(std::vector<uint8_t> *buffer) : buffer_(buffer) {}
-  void write(uint8_t value) { this->buffer_->push_back(value); }
-  void encode_varint_raw(ProtoVarInt value) { value.encode(*this->buffer_); }
-  void encode_varint_raw(uint32_t value) { this->encode_varint_raw(ProtoVarInt(value)); }
+  ProtoWriteBuffer(uint8_t *pos, size_t size) : pos_(pos) {
+#ifdef ESPHOME_DEBUG_API
+    this->end_ = pos + size;
+#endif
+  }
+  void write(uint8_t value) { *this->pos_++ = value; }
+  void encode_varint_raw(uint32_t value) {
+    while (value > 0x7F) {
+      *this->pos_++ = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *this->pos_++ = static_cast<uint8_t>(value);
+  }
+  void encode_varint_raw(uint64_t value) {
+    while (value > 0x7F) {
+      *this->pos_++ = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *this->pos_++ = static_cast<uint8_t>(value);
+  }
   void encode_field_raw(uint32_t field_id, uint32_t type) {
     uint32_t val = (field_id << 3) | (type & 0b111);
     this->encode_varint_raw(val);
@@ -158,12 +295,12 @@ class ProtoWriteBuffer {
       return;
 
     this->encode_field_raw(field_id, 2);
-    this->encode_varint_raw(len);
-    auto *data = reinterpret_cast<const uint8_t *>(string);
-    this->buffer_->insert(this->buffer_->end(), data, data + len);
+    this->encode_varint_raw(static_cast<uint32_t>(len));
+    memcpy(this->pos_, string, len);
+    this->pos_ += len;
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -178,13 +315,13 @@ class ProtoWriteBuffer {
     if (value == 0 && !force)
       return;
     this->encode_field_raw(field_id, 0);
-    this->encode_varint_raw(ProtoVarInt(value));
+    this->encode_varint_raw(value);
   }
   void encode_bool(uint32_t field_id, bool value, bool force = false) {
     if (!value && !force)
       return;
     this->encode_field_raw(field_id, 0);
-    this->write(0x01);
+    this->write(value ? 0x01 : 0x00);
   }
   void encode_fixed32(uint32_t field_id, uint32_t value, bool force = false) {
     if (value == 0 && !force)
@@ -200,7 +337,7 @@ class ProtoWriteBuffer {
     if (value == 0 && !force)
       return;
 
-    this->encode_field_raw(field_id, 5);
+    this->encode_field_raw(field_id, 1);
     this->write((value >> 0) & 0xFF);
     this->write((value >> 8) & 0xFF);
     this->write((value >> 16) & 0xFF);
@@ -222,7 +359,7 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, true);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -236,45 +373,41 @@ class ProtoWriteBuffer {
     this->encode_uint64(field_id, static_cast<uint64_t>(value), force);
   }
   void encode_sint32(uint32_t field_id, int32_t value, bool force = false) {
-    uint32_t uvalue;
-    if (value < 0) {
-      uvalue = ~(value << 1);
-    } else {
-      uvalue = value << 1;
-    }
-    this->encode_uint32(field_id, uvalue, force);
+    this->encode_uint32(field_id, ProtoSize::zigzag(value), force);
   }
   void encode_sint64(uint32_t field_id, int64_t value, bool force = false) {
-    uint64_t uvalue;
-    if (value < 0) {
-      uvalue = ~(value << 1);
-    } else {
-      uvalue = value << 1;
-    }
-    this->encode_uint64(field_id, uvalue, force);
+    this->encode_uint64(field_id, ProtoSize::zigzag(value), force);
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
-    value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    this->encode_varint_raw(nested_length);
+    // The nested message is written through its own buffer, skip over what it wrote
+    value.encode(ProtoWriteBuffer(this->pos_, nested_length));
+    this->pos_ += nested_length;
+  }
+  uint8_t *get_pos() const { return this->pos_; }
+  /// With ESPHOME_DEBUG_API, assert that exactly the reserved size was written.
+  void check_end() const {
+#ifdef ESPHOME_DEBUG_API
+    assert(this->pos_ == this->end_);
+#endif
   }
-  std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
  protected:
-  std::vector<uint8_t> *buffer_;
+  uint8_t *pos_;
+#ifdef ESPHOME_DEBUG_API
+  uint8_t *end_;
+#endif
 };
 
 class ProtoMessage {
  public:
   virtual ~ProtoMessage() = default;
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the encoded size of this message to total_size.
+  virtual void calculate_size(uint32_t &total_size) const = 0;
   void decode(const uint8_t *buffer, size_t length);
 #ifdef HAS_PROTO_MESSAGE_DUMP
   std::string dump() const;
@@ -298,12 +431,15 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /// Return a buffer with room for a message of the given encoded size.
+  virtual ProtoWriteBuffer create_buffer(uint32_t size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
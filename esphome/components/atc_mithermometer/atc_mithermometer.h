@@ -19,10 +19,8 @@ struct ParseResult {
   int raw_offset;
 };
 
-class ATCMiThermometer : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class ATCMiThermometer : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; };
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -33,7 +31,6 @@ class ATCMiThermometer : public Component, public esp32_ble_tracker::ESPBTDevice
   void set_signal_strength(sensor::Sensor *signal_strength) { signal_strength_ = signal_strength; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
@@ -8,6 +8,8 @@ AUTO_LOAD = ["esp32_ble_client", "esp32_ble_tracker"]
 DEPENDENCIES = ["api", "esp32"]
 CODEOWNERS = ["@jesserockz"]
 
+CONF_ADVERTISEMENT_BATCH_SIZE = "advertisement_batch_size"
+CONF_ADVERTISEMENT_BATCH_WINDOW = "advertisement_batch_window"
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
 MAX_CONNECTIONS = 3
@@ -49,6 +51,12 @@ CONFIG_SCHEMA = cv.All(
         {
             cv.GenerateID(): cv.declare_id(BluetoothProxy),
             cv.Optional(CONF_ACTIVE, default=False): cv.boolean,
+            cv.Optional(
+                CONF_ADVERTISEMENT_BATCH_WINDOW, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_ADVERTISEMENT_BATCH_SIZE, default=16): cv.int_range(
+                min=1, max=64
+            ),
             cv.SplitDefault(CONF_CACHE_SERVICES, esp32_idf=True): cv.All(
                 cv.only_with_esp_idf, cv.boolean
             ),
@@ -69,6 +77,10 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    cg.add(
+        var.set_advertisement_batch_window(config[CONF_ADVERTISEMENT_BATCH_WINDOW])
+    )
+    cg.add(var.set_advertisement_batch_size(config[CONF_ADVERTISEMENT_BATCH_SIZE]))
     await esp32_ble_tracker.register_ble_device(var, config)
 
     for connection_conf in config.get(CONF_CONNECTIONS, []):
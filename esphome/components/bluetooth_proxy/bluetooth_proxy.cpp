@@ -1,8 +1,12 @@
 #include "bluetooth_proxy.h"
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 
+#include <cinttypes>
+#include <cstring>
+
 #ifdef USE_ESP32
 
 namespace esphome {
@@ -39,29 +43,61 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr || !this->raw_advertisements_)
     return false;
 
-  api::BluetoothLERawAdvertisementsResponse resp;
+  auto &batch = this->advertisement_batch_.advertisements;
   for (size_t i = 0; i < count; i++) {
     auto &result = advertisements[i];
-    api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
-    adv.rssi = result.rssi;
-    adv.address_type = result.ble_addr_type;
-
-    uint8_t length = result.adv_data_len + result.scan_rsp_len;
-    adv.data.reserve(length);
-    for (uint16_t i = 0; i < length; i++) {
-      adv.data.push_back(result.ble_adv[i]);
+    const uint64_t address = esp32_ble::ble_addr_to_uint64(result.bda);
+    const uint8_t length = result.adv_data_len + result.scan_rsp_len;
+    const char *data = reinterpret_cast<const char *>(result.ble_adv);
+    this->advertisements_received_++;
+
+    // A device repeats the same advertisement many times per second, only its latest RSSI is worth sending
+    bool duplicate = false;
+    for (auto &pending : batch) {
+      if (pending.address == address && pending.address_type == result.ble_addr_type &&
+          pending.data.size() == length && memcmp(pending.data.data(), data, length) == 0) {
+        pending.rssi = result.rssi;
+        duplicate = true;
+        break;
+      }
+    }
+    if (duplicate) {
+      this->advertisements_deduplicated_++;
+      continue;
     }
 
-    resp.advertisements.push_back(std::move(adv));
+    if (batch.empty())
+      this->advertisement_batch_start_ = millis();
+    batch.emplace_back();
+    auto &adv = batch.back();
+    adv.address = address;
+    adv.rssi = result.rssi;
+    adv.address_type = result.ble_addr_type;
+    adv.data.assign(data, length);
 
     ESP_LOGV(TAG, "Proxying raw packet from %02X:%02X:%02X:%02X:%02X:%02X, length %d. RSSI: %d dB", result.bda[0],
              result.bda[1], result.bda[2], result.bda[3], result.bda[4], result.bda[5], length, result.rssi);
+
+    if (batch.size() >= this->advertisement_batch_size_)
+      this->flush_advertisements_();
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
-  this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
+  if (this->advertisement_batch_window_ == 0)
+    this->flush_advertisements_();
   return true;
 }
+
+void BluetoothProxy::flush_advertisements_() {
+  auto &batch = this->advertisement_batch_.advertisements;
+  if (batch.empty())
+    return;
+  if (this->api_connection_ != nullptr && this->raw_advertisements_) {
+    ESP_LOGV(TAG, "Proxying %zu packets", batch.size());
+    this->api_connection_->send_bluetooth_le_raw_advertisements_response(this->advertisement_batch_);
+    this->advertisements_forwarded_ += batch.size();
+  }
+  batch.clear();
+}
+
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -92,6 +128,10 @@ void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG, "  Active: %s", YESNO(this->active_));
   ESP_LOGCONFIG(TAG, "  Connections: %d", this->connections_.size());
   ESP_LOGCONFIG(TAG, "  Raw advertisements: %s", YESNO(this->raw_advertisements_));
+  ESP_LOGCONFIG(TAG, "  Advertisement batch window: %" PRIu32 " ms", this->advertisement_batch_window_);
+  ESP_LOGCONFIG(TAG, "  Advertisement batch size: %u", this->advertisement_batch_size_);
+  ESP_LOGCONFIG(TAG, "  Advertisements received: %" PRIu32 ", forwarded: %" PRIu32 ", deduplicated: %" PRIu32,
+                this->advertisements_received_, this->advertisements_forwarded_, this->advertisements_deduplicated_);
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
@@ -115,8 +155,13 @@ void BluetoothProxy::loop() {
         connection->disconnect();
       }
     }
+    this->advertisement_batch_.advertisements.clear();
     return;
   }
+  if (!this->advertisement_batch_.advertisements.empty() &&
+      millis() - this->advertisement_batch_start_ >= this->advertisement_batch_window_) {
+    this->flush_advertisements_();
+  }
   for (auto *connection : this->connections_) {
     if (connection->send_service_ == connection->service_count_) {
       connection->send_service_ = DONE_SENDING_SERVICES;
@@ -456,6 +501,7 @@ void BluetoothProxy::unsubscribe_api_connection(api::APIConnection *api_connecti
   }
   this->api_connection_ = nullptr;
   this->raw_advertisements_ = false;
+  this->advertisement_batch_.advertisements.clear();
   this->parent_->recalculate_advertisement_parser_types();
 }
 
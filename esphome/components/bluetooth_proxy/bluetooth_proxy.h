@@ -92,6 +92,14 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
   void set_active(bool active) { this->active_ = active; }
   bool has_active() { return this->active_; }
+  /// How long raw advertisements are collected before they are sent, 0 to send them once per scan result batch.
+  void set_advertisement_batch_window(uint32_t batch_window) { this->advertisement_batch_window_ = batch_window; }
+  /// Maximum number of raw advertisements sent in one message.
+  void set_advertisement_batch_size(uint16_t batch_size) { this->advertisement_batch_size_ = batch_size; }
+
+  uint32_t get_advertisements_received() const { return this->advertisements_received_; }
+  uint32_t get_advertisements_forwarded() const { return this->advertisements_forwarded_; }
+  uint32_t get_advertisements_deduplicated() const { return this->advertisements_deduplicated_; }
 
   uint32_t get_legacy_version() const {
     if (this->active_) {
@@ -116,6 +124,7 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
  protected:
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  void flush_advertisements_();
 
   BluetoothConnection *get_connection_(uint64_t address, bool reserve);
 
@@ -124,6 +133,16 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+
+  /// Raw advertisements waiting to be sent, at most one per address and advertisement data.
+  api::BluetoothLERawAdvertisementsResponse advertisement_batch_;
+  /// When the oldest advertisement in the batch was received.
+  uint32_t advertisement_batch_start_{0};
+  uint32_t advertisement_batch_window_{0};
+  uint16_t advertisement_batch_size_{16};
+  uint32_t advertisements_received_{0};
+  uint32_t advertisements_forwarded_{0};
+  uint32_t advertisements_deduplicated_{0};
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
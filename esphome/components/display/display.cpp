@@ -1,6 +1,7 @@
 #include "display.h"
 #include <utility>
 #include "display_color_utils.h"
+#include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
@@ -34,6 +35,7 @@ void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
       y1 += sy;
     }
   }
+  App.feed_wdt();
 }
 
 void Display::line_at_angle(int x, int y, int angle, int length, Color color) {
@@ -82,18 +84,15 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
       }
       this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
     }
+    App.feed_wdt();
   }
 }
 
 void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+  this->filled_rectangle_internal(x, y, width, 1, color);
 }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+  this->filled_rectangle_internal(x, y, 1, height, color);
 }
 void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
@@ -102,11 +101,19 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+  this->filled_rectangle_internal(x1, y1, width, height, color);
+}
+void HOT Display::filled_rectangle_internal(int x1, int y1, int width, int height, Color color) {
+  for (int y = y1; y < y1 + height; y++) {
+    for (int x = x1; x < x1 + width; x++)
+      this->draw_pixel_at(x, y, color);
+    App.feed_wdt();
   }
 }
+void HOT Display::draw_row_internal(int x, int y, int width, const Color *colors) {
+  for (int i = 0; i < width; i++)
+    this->draw_pixel_at(x + i, y, colors[i]);
+}
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
   int dx = -radius;
   int dy = 0;
@@ -128,6 +135,7 @@ void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
     if (e2 > dx) {
       err += ++dx * 2 + 1;
     }
+    App.feed_wdt();
   } while (dx <= 0);
 }
 void Display::filled_circle(int center_x, int center_y, int radius, Color color) {
@@ -154,6 +162,7 @@ void Display::filled_circle(int center_x, int center_y, int radius, Color color)
     if (e2 > dx) {
       err += ++dx * 2 + 1;
     }
+    App.feed_wdt();
   } while (dx <= 0);
 }
 void Display::filled_ring(int center_x, int center_y, int radius1, int radius2, Color color) {
@@ -256,6 +256,9 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /// Draw a row of width pixels starting at [x,y] to the right, with a color for each pixel.
+  void draw_row(int x, int y, int width, const Color *colors) { this->draw_row_internal(x, y, width, colors); }
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -668,6 +671,13 @@ class Display : public PollingComponent {
   virtual int get_height_internal() = 0;
   virtual int get_width_internal() = 0;
 
+  /// Fill a rectangle, the primitive behind filled_rectangle() and the straight lines. The default draws it pixel by
+  /// pixel, displays with a buffer override it to resolve clipping and rotation once for the whole rectangle.
+  virtual void filled_rectangle_internal(int x1, int y1, int width, int height, Color color);
+  /// Draw a row of pixels, the primitive behind draw_row(). The default draws it pixel by pixel, displays with a
+  /// buffer override it to resolve clipping and rotation once for the whole row.
+  virtual void draw_row_internal(int x, int y, int width, const Color *colors);
+
   /**
    * This method fills a triangle using only integer variables by using a
    * modified bresenham algorithm.
@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -20,6 +21,75 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->clear();
 }
 
+void DisplayBuffer::init_dirty_tiles_(uint8_t tile_height_shift) {
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  // smallest tile width of at least 8 pixels that fits a row of tiles in one word
+  uint8_t tile_width_shift = 3;
+  while ((width + (1 << tile_width_shift) - 1) >> tile_width_shift > 32)
+    tile_width_shift++;
+  this->tile_width_shift_ = tile_width_shift;
+  this->tile_height_shift_ = tile_height_shift;
+  this->dirty_tiles_.assign((height + (1 << tile_height_shift) - 1) >> tile_height_shift, 0);
+  ESP_LOGV(TAG, "Tracking changes in %dx%d tiles", 1 << tile_width_shift, 1 << tile_height_shift);
+  this->mark_all_dirty_();
+}
+
+void DisplayBuffer::mark_dirty_(int x1, int y1, int x2, int y2) {
+  if (this->dirty_tiles_.empty() || x2 < x1 || y2 < y1)
+    return;
+  const int col1 = x1 >> this->tile_width_shift_;
+  const int col2 = x2 >> this->tile_width_shift_;
+  // bits col1 to col2, the shift is split as shifting a 32 bit value by 32 is undefined
+  const uint32_t mask = ((2u << col2) - 1) & ~((1u << col1) - 1);
+  for (int row = y1 >> this->tile_height_shift_; row <= y2 >> this->tile_height_shift_; row++)
+    this->dirty_tiles_[row] |= mask;
+  this->dirty_area_.extend(x1, y1);
+  this->dirty_area_.extend(x2, y2);
+}
+
+void DisplayBuffer::mark_all_dirty_() {
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
+}
+
+bool DisplayBuffer::has_dirty_tiles_() const {
+  for (auto tiles : this->dirty_tiles_) {
+    if (tiles != 0)
+      return true;
+  }
+  return false;
+}
+
+void DisplayBuffer::flush_dirty_regions_(const std::function<void(int x1, int y1, int x2, int y2)> &flush) {
+  const DirtyArea area = this->dirty_area_;
+  this->dirty_area_ = DirtyArea{};
+  const size_t rows = this->dirty_tiles_.size();
+  for (size_t row = 0; row != rows; row++) {
+    uint32_t &tiles = this->dirty_tiles_[row];
+    while (tiles != 0) {
+      // first run of dirty tiles in this row
+      int col1 = 0;
+      while ((tiles & (1u << col1)) == 0)
+        col1++;
+      int col2 = col1;
+      while (col2 != 31 && (tiles & (2u << col2)) != 0)
+        col2++;
+      const uint32_t mask = ((2u << col2) - 1) & ~((1u << col1) - 1);
+      tiles &= ~mask;
+      // extend it over the following rows that are dirty at the same columns
+      size_t last_row = row;
+      while (last_row + 1 != rows && (this->dirty_tiles_[last_row + 1] & mask) == mask) {
+        last_row++;
+        this->dirty_tiles_[last_row] &= ~mask;
+      }
+      flush(std::max(col1 << this->tile_width_shift_, (int) area.x1),
+            std::max((int) row << this->tile_height_shift_, (int) area.y1),
+            std::min(((col2 + 1) << this->tile_width_shift_) - 1, (int) area.x2),
+            std::min((int) ((last_row + 1) << this->tile_height_shift_) - 1, (int) area.y2));
+    }
+  }
+}
+
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_90_DEGREES:
@@ -65,7 +135,97 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
       break;
   }
   this->draw_absolute_pixel_internal(x, y, color);
-  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::filled_rectangle_internal(int x1, int y1, int width, int height, Color color) {
+  // Clip to the display and to the clipping rectangle, whose right and bottom edge are included like in draw_pixel_at()
+  int x2 = std::min(x1 + width, this->get_width());
+  int y2 = std::min(y1 + height, this->get_height());
+  x1 = std::max(x1, 0);
+  y1 = std::max(y1, 0);
+  const Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    x1 = std::max(x1, (int) clipping.x);
+    y1 = std::max(y1, (int) clipping.y);
+    x2 = std::min(x2, clipping.x2() + 1);
+    y2 = std::min(y2, clipping.y2() + 1);
+  }
+  if (x1 >= x2 || y1 >= y2)
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->filled_absolute_rectangle_internal(x1, y1, x2 - x1, y2 - y1, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      this->filled_absolute_rectangle_internal(this->get_width_internal() - y2, x1, y2 - y1, x2 - x1, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->filled_absolute_rectangle_internal(this->get_width_internal() - x2, this->get_height_internal() - y2,
+                                               x2 - x1, y2 - y1, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      this->filled_absolute_rectangle_internal(y1, this->get_height_internal() - x2, y2 - y1, x2 - x1, color);
+      break;
+  }
+}
+
+void HOT DisplayBuffer::draw_row_internal(int x, int y, int width, const Color *colors) {
+  // Clip like filled_rectangle_internal()
+  int x1 = std::max(x, 0);
+  int x2 = std::min(x + width, this->get_width());
+  if (y < 0 || y >= this->get_height())
+    return;
+  const Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    if (y < clipping.y || y > clipping.y2())
+      return;
+    x1 = std::max(x1, (int) clipping.x);
+    x2 = std::min(x2, clipping.x2() + 1);
+  }
+  if (x1 >= x2)
+    return;
+  colors += x1 - x;
+
+  // Native position of the first pixel and the step to the next one, rotated like in draw_pixel_at()
+  int native_x = x1;
+  int native_y = y;
+  int step_x = 1;
+  int step_y = 0;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      native_x = this->get_width_internal() - y - 1;
+      native_y = x1;
+      step_x = 0;
+      step_y = 1;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      native_x = this->get_width_internal() - x1 - 1;
+      native_y = this->get_height_internal() - y - 1;
+      step_x = -1;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      native_x = y;
+      native_y = this->get_height_internal() - x1 - 1;
+      step_x = 0;
+      step_y = -1;
+      break;
+  }
+  for (int i = 0; i < x2 - x1; i++) {
+    this->draw_absolute_pixel_internal(native_x, native_y, colors[i]);
+    native_x += step_x;
+    native_y += step_y;
+  }
+}
+
+void HOT DisplayBuffer::filled_absolute_rectangle_internal(int x1, int y1, int width, int height, Color color) {
+  for (int y = y1; y < y1 + height; y++) {
+    for (int x = x1; x < x1 + width; x++)
+      this->draw_absolute_pixel_internal(x, y, color);
+    App.feed_wdt();
+  }
 }
 
 }  // namespace display
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdarg>
+#include <functional>
 #include <vector>
 
 #include "display.h"
@@ -24,10 +25,64 @@ class DisplayBuffer : public Display {
 
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+  /// Fill a rectangle in native (unrotated) coordinates that lies within the display. The default draws it pixel by
+  /// pixel, displays override it to fill whole rows of their buffer at once.
+  virtual void filled_absolute_rectangle_internal(int x1, int y1, int width, int height, Color color);
+
+  void filled_rectangle_internal(int x1, int y1, int width, int height, Color color) override;
+  void draw_row_internal(int x, int y, int width, const Color *colors) override;
 
   void init_internal_(uint32_t buffer_length);
 
+  /** Start tracking which parts of the buffer changed, so only those have to be sent to the display.
+   *
+   * The native display area is split into tiles, one bit each, with the tile width chosen so a row of tiles fits in
+   * 32 bits. Displays call this once their dimensions are known and mark what they change with mark_dirty_().
+   *
+   * @param tile_height_shift The tile height as a power of two.
+   */
+  void init_dirty_tiles_(uint8_t tile_height_shift = 4);
+  /// Mark the tile of a pixel in native coordinates as changed.
+  inline void mark_dirty_(int x, int y) {
+    if (this->dirty_tiles_.empty())
+      return;
+    this->dirty_tiles_[y >> this->tile_height_shift_] |= 1u << (x >> this->tile_width_shift_);
+    this->dirty_area_.extend(x, y);
+  }
+  /// Mark the tiles covered by a rectangle in native coordinates as changed, the second corner is included.
+  void mark_dirty_(int x1, int y1, int x2, int y2);
+  void mark_all_dirty_();
+  bool has_dirty_tiles_() const;
+  /** Call flush(x1, y1, x2, y2) for each changed region in native coordinates, corners included, then clear them.
+   *
+   * Adjacent dirty tiles of a tile row are coalesced into one region, which is extended down over the following tile
+   * rows as long as they are dirty at the same columns, so each region maps to one address window of the display.
+   * Regions are trimmed to the bounding box of all changes, never overlap and are reported top to bottom.
+   */
+  void flush_dirty_regions_(const std::function<void(int x1, int y1, int x2, int y2)> &flush);
+
   uint8_t *buffer_{nullptr};
+  /// One bit per tile of each row of tiles, empty if the display doesn't track changes.
+  std::vector<uint32_t> dirty_tiles_;
+  uint8_t tile_width_shift_{0};
+  uint8_t tile_height_shift_{0};
+  /// Bounding box of the changes, which trims the regions when only a small part of a tile changed.
+  struct DirtyArea {
+    int16_t x1{INT16_MAX};
+    int16_t y1{INT16_MAX};
+    int16_t x2{-1};
+    int16_t y2{-1};
+    inline void extend(int x, int y) {
+      if (x < this->x1)
+        this->x1 = x;
+      if (y < this->y1)
+        this->y1 = y;
+      if (x > this->x2)
+        this->x2 = x;
+      if (y > this->y2)
+        this->y2 = y;
+    }
+  } dirty_area_;
 };
 
 }  // namespace display
@@ -92,6 +92,8 @@ class Dsmr : public Component, public uart::UARTDevice {
   void receive_telegram_();
   void receive_encrypted_telegram_();
   void reset_telegram_();
+  /// Discard everything received on the UART bus.
+  void drain_rx_();
 
   /// Wait for UART data to become available within the read timeout.
   ///
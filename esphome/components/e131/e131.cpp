@@ -8,6 +8,8 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+/// Maximum number of packets received per loop, so that a flood of packets can't block the main loop.
+static const int MAX_PACKETS_PER_LOOP = 64;
 
 E131Component::E131Component() {}
 
@@ -53,25 +55,46 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
-  E131Packet packet;
-  int universe = 0;
-  uint8_t buf[1460];
-
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
-  }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
-
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
+  // Receive all queued packets first: a sender runs at a fixed frame rate per universe, and only the latest frame of
+  // each universe has to be applied
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    if (!this->receive_buffer_)
+      this->receive_buffer_.reset(new uint8_t[E131_MAX_PACKET_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+
+    ssize_t len = this->socket_->read(this->receive_buffer_.get(), E131_MAX_PACKET_SIZE);
+    if (len == -1) {
+      break;
+    }
+
+    E131Packet packet;
+    int universe = 0;
+    if (!this->packet_(this->receive_buffer_.get(), len, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+
+    auto consumers = this->universe_consumers_.find(universe);
+    if (consumers == this->universe_consumers_.end() || consumers->second == 0) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+      continue;
+    }
+
+    // Keep the packet where it was received, packet.values points into that buffer. The buffer of an older packet of
+    // the universe is received into next.
+    UniverseFrame &frame = this->universe_frames_[universe];
+    std::swap(frame.buffer, this->receive_buffer_);
+    frame.packet = packet;
+    frame.pending = true;
   }
 
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  for (auto &it : this->universe_frames_) {
+    UniverseFrame &frame = it.second;
+    if (!frame.pending)
+      continue;
+    frame.pending = false;
+    if (!this->process_(it.first, frame.packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", it.first, frame.packet.count);
+    }
   }
 }
 
@@ -18,10 +18,13 @@ class E131AddressableLightEffect;
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
+/// Size of the largest E1.31 data packet, a full universe.
+const size_t E131_MAX_PACKET_SIZE = 638;
 
+/// The DMX data of a received packet, values points into the buffer the packet was received into.
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  const uint8_t *values;
 };
 
 class E131Component : public esphome::Component {
@@ -39,7 +42,7 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
   bool join_igmp_groups_();
   void join_(int universe);
@@ -49,7 +52,16 @@ class E131Component : public esphome::Component {
   std::unique_ptr<socket::Socket> socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+
+  /// The latest packet received for a universe, not applied yet if pending.
+  struct UniverseFrame {
+    std::unique_ptr<uint8_t[]> buffer;
+    E131Packet packet;
+    bool pending;
+  };
+  std::map<int, UniverseFrame> universe_frames_;
+  /// Buffer the next packet is received into, it is swapped with the buffer of its universe.
+  std::unique_ptr<uint8_t[]> receive_buffer_;
 };
 
 }  // namespace e131
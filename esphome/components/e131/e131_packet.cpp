@@ -51,7 +51,7 @@ union E131RawPacket {
     uint8_t property_values[E131_MAX_PROPERTY_VALUES_COUNT];
   } __attribute__((packed));
 
-  uint8_t raw[638];
+  uint8_t raw[E131_MAX_PACKET_SIZE];
 };
 
 // We need to have at least one `1` value
@@ -106,15 +106,16 @@ void E131Component::leave_(int universe) {
 
     igmp_leavegroup(IP4_ADDR_ANY4, &multicast_addr);
   }
+  this->universe_frames_.erase(universe);
 
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -131,8 +132,11 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  // The values are used where they were received, they must all have been received
+  if (len < E131_MIN_PACKET_SIZE - 1 + packet.count)
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  packet.values = sbuff->property_values;
   return true;
 }
 
@@ -341,9 +341,17 @@ void ESP32BLE::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_pa
     return;
   }
   new (new_event) BLEEvent(event, param);
-  global_ble->ble_events_.push(new_event);
+  global_ble->enqueue_event_(new_event);
 }  // NOLINT(clang-analyzer-unix.Malloc)
 
+void ESP32BLE::enqueue_event_(BLEEvent *event) {
+  this->ble_events_.push(event);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // Handle the event in the next loop iteration instead of after the rest of the loop interval
+  App.wake_loop_threadsafe();
+#endif
+}
+
 void ESP32BLE::real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
   ESP_LOGV(TAG, "(BLE) gap_event_handler - %d", event);
   for (auto *gap_handler : this->gap_event_handlers_) {
@@ -359,7 +367,7 @@ void ESP32BLE::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gat
     return;
   }
   new (new_event) BLEEvent(event, gatts_if, param);
-  global_ble->ble_events_.push(new_event);
+  global_ble->enqueue_event_(new_event);
 }  // NOLINT(clang-analyzer-unix.Malloc)
 
 void ESP32BLE::real_gatts_event_handler_(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
@@ -378,7 +386,7 @@ void ESP32BLE::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gat
     return;
   }
   new (new_event) BLEEvent(event, gattc_if, param);
-  global_ble->ble_events_.push(new_event);
+  global_ble->enqueue_event_(new_event);
 }  // NOLINT(clang-analyzer-unix.Malloc)
 
 void ESP32BLE::real_gattc_event_handler_(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
@@ -115,6 +115,8 @@ class ESP32BLE : public Component {
   void real_gatts_event_handler_(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
   void real_gattc_event_handler_(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
   void real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param);
+  /// Hand an event from the BLE stack's task over to loop().
+  void enqueue_event_(BLEEvent *event);
 
   bool ble_setup_();
   bool ble_dismantle_();
@@ -0,0 +1,64 @@
+#include "advertisement.h"
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+static uint16_t read_uint16(const uint8_t *data) { return uint16_t(data[0]) | (uint16_t(data[1]) << 8); }
+
+void AdvertisementView::Iterator::advance_(size_t offset) {
+  // Skip zero length records, which are used for padding
+  while (offset < this->length_ && this->payload_[offset] == 0)
+    offset++;
+  // Each record is a length byte followed by the type and the data, stop at the first one that doesn't fit
+  if (offset + 2 > this->length_ || offset + 1 + this->payload_[offset] > this->length_) {
+    this->offset_ = this->length_;
+    return;
+  }
+  this->offset_ = offset;
+  this->record_.type = this->payload_[offset + 1];
+  this->record_.length = this->payload_[offset] - 1;
+  this->record_.data = this->payload_ + offset + 2;
+  this->next_ = offset + 1 + this->payload_[offset];
+}
+
+bool AdvertisementView::find(uint8_t type, AdvertisementRecord *record) const {
+  for (const auto &it : *this) {
+    if (it.type == type) {
+      *record = it;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool AdvertisementView::has_service_uuid(uint16_t uuid) const {
+  for (const auto &record : *this) {
+    if (record.type != AD_TYPE_16BIT_SERVICE_UUIDS_PARTIAL && record.type != AD_TYPE_16BIT_SERVICE_UUIDS_COMPLETE)
+      continue;
+    for (uint8_t i = 0; i + 1 < record.length; i += 2) {
+      if (read_uint16(record.data + i) == uuid)
+        return true;
+    }
+  }
+  return false;
+}
+
+bool AdvertisementView::has_service_data(uint16_t uuid) const {
+  for (const auto &record : *this) {
+    if (record.type == AD_TYPE_16BIT_SERVICE_DATA && record.length >= 2 && read_uint16(record.data) == uuid)
+      return true;
+  }
+  return false;
+}
+
+bool AdvertisementView::has_manufacturer_data(uint16_t company_id) const {
+  for (const auto &record : *this) {
+    if (record.type == AD_TYPE_MANUFACTURER_SPECIFIC_DATA && record.length >= 2 &&
+        read_uint16(record.data) == company_id)
+      return true;
+  }
+  return false;
+}
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+/// Advertising data types, see the Generic Access Profile section of the Bluetooth Assigned Numbers.
+enum AdvertisementDataType : uint8_t {
+  AD_TYPE_FLAGS = 0x01,
+  AD_TYPE_16BIT_SERVICE_UUIDS_PARTIAL = 0x02,
+  AD_TYPE_16BIT_SERVICE_UUIDS_COMPLETE = 0x03,
+  AD_TYPE_32BIT_SERVICE_UUIDS_PARTIAL = 0x04,
+  AD_TYPE_32BIT_SERVICE_UUIDS_COMPLETE = 0x05,
+  AD_TYPE_128BIT_SERVICE_UUIDS_PARTIAL = 0x06,
+  AD_TYPE_128BIT_SERVICE_UUIDS_COMPLETE = 0x07,
+  AD_TYPE_SHORTENED_LOCAL_NAME = 0x08,
+  AD_TYPE_COMPLETE_LOCAL_NAME = 0x09,
+  AD_TYPE_TX_POWER_LEVEL = 0x0A,
+  AD_TYPE_16BIT_SERVICE_DATA = 0x16,
+  AD_TYPE_APPEARANCE = 0x19,
+  AD_TYPE_32BIT_SERVICE_DATA = 0x20,
+  AD_TYPE_128BIT_SERVICE_DATA = 0x21,
+  AD_TYPE_MANUFACTURER_SPECIFIC_DATA = 0xFF,
+};
+
+/// One AD structure of an advertisement, pointing into the advertisement payload.
+struct AdvertisementRecord {
+  uint8_t type;
+  uint8_t length;
+  const uint8_t *data;
+};
+
+/** Read-only view of the advertising and scan response data of one scan result.
+ *
+ * Iterates over the AD structures in place, without copying or allocating, so listeners can decide whether an
+ * advertisement is of interest before it's parsed into an ESPBTDevice. Doesn't depend on ESP-IDF, so it can also be
+ * used on the host platform. A truncated last record is ignored.
+ */
+class AdvertisementView {
+ public:
+  class Iterator {
+   public:
+    Iterator(const uint8_t *payload, size_t length, size_t offset) : payload_(payload), length_(length) {
+      this->advance_(offset);
+    }
+    const AdvertisementRecord &operator*() const { return this->record_; }
+    const AdvertisementRecord *operator->() const { return &this->record_; }
+    Iterator &operator++() {
+      this->advance_(this->next_);
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const { return this->offset_ != other.offset_; }
+
+   protected:
+    void advance_(size_t offset);
+
+    const uint8_t *payload_;
+    size_t length_;
+    /// Offset of the current record, the payload length at the end.
+    size_t offset_;
+    size_t next_;
+    AdvertisementRecord record_{};
+  };
+
+  AdvertisementView(uint64_t address, const uint8_t *payload, size_t length)
+      : address_(address), payload_(payload), length_(length) {}
+
+  /// The address of the advertising device, in the same format as ESPBTDevice::address_uint64().
+  uint64_t get_address() const { return this->address_; }
+  const uint8_t *get_payload() const { return this->payload_; }
+  size_t get_length() const { return this->length_; }
+
+  Iterator begin() const { return Iterator(this->payload_, this->length_, 0); }
+  Iterator end() const { return Iterator(this->payload_, this->length_, this->length_); }
+
+  /// Find the first record of the given type, returns false if there is none.
+  bool find(uint8_t type, AdvertisementRecord *record) const;
+  /// Whether the 16-bit service UUID is listed in the advertised service UUIDs.
+  bool has_service_uuid(uint16_t uuid) const;
+  /// Whether the advertisement contains service data for the 16-bit service UUID.
+  bool has_service_data(uint16_t uuid) const;
+  /// Whether the advertisement contains manufacturer specific data of the company.
+  bool has_manufacturer_data(uint16_t company_id) const;
+
+ protected:
+  uint64_t address_;
+  const uint8_t *payload_;
+  size_t length_;
+};
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
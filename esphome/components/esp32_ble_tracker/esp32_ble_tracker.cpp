@@ -136,17 +136,29 @@ void ESP32BLETracker::loop() {
 
       if (this->parse_advertisements_) {
         for (size_t i = 0; i < index; i++) {
+          const auto &scan_result = this->scan_result_buffer_[i];
+          AdvertisementView view(ble_addr_to_uint64(scan_result.bda), scan_result.ble_adv,
+                                 scan_result.adv_data_len + scan_result.scan_rsp_len);
+          // Only parse the advertisement if any listener is interested in it, or to log devices nobody claimed
+          bool wanted = !this->scan_continuous_;
+          for (auto *listener : this->listeners_)
+            wanted = wanted || listener->accepts_advertisement(view);
+          for (auto *client : this->clients_)
+            wanted = wanted || client->accepts_advertisement(view);
+          if (!wanted)
+            continue;
+
           ESPBTDevice device;
-          device.parse_scan_rst(this->scan_result_buffer_[i]);
+          device.parse_scan_rst(scan_result);
 
           bool found = false;
           for (auto *listener : this->listeners_) {
-            if (listener->parse_device(device))
+            if (listener->accepts_advertisement(view) && listener->parse_device(device))
               found = true;
           }
 
           for (auto *client : this->clients_) {
-            if (client->parse_device(device)) {
+            if (client->accepts_advertisement(view) && client->parse_device(device)) {
               found = true;
               if (!connecting && client->state() == ClientState::DISCOVERED) {
                 promote_to_connecting = true;
@@ -506,21 +518,11 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
 #endif
 }
 void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
-  size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
+  AdvertisementView view(this->address_uint64(), param.ble_adv, param.adv_data_len + param.scan_rsp_len);
+  for (const auto &it : view) {
+    const uint8_t record_type = it.type;
+    const uint8_t *record = it.data;
+    const uint8_t record_length = it.length;
 
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
@@ -546,7 +548,9 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        if (record_length < 1)
+          break;
+        this->tx_powers_.push_back(*record);
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -555,6 +559,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // See also https://www.bluetooth.com/specifications/gatt/characteristics/
         // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
         // the AD and SRD of the same extended advertising interval.
+        if (record_length < 2)
+          break;
         this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
         break;
       }
@@ -564,6 +570,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
         // omitted."
         // CSS 1: Optional in this context; shall not appear more than once in a block.
+        if (record_length < 1)
+          break;
         this->ad_flag_ = *record;
         break;
       }
@@ -590,6 +598,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
       case ESP_BLE_AD_TYPE_128SRV_CMPL:
       case ESP_BLE_AD_TYPE_128SRV_PART: {
         // • Global 128-bit Service UUIDs
+        if (record_length < 16)
+          break;
         this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
         break;
       }
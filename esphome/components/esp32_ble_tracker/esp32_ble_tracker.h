@@ -21,6 +21,8 @@
 #include "esphome/components/esp32_ble/ble.h"
 #include "esphome/components/esp32_ble/ble_uuid.h"
 
+#include "advertisement.h"
+
 namespace esphome {
 namespace esp32_ble_tracker {
 
@@ -120,6 +122,9 @@ class ESP32BLETracker;
 class ESPBTDeviceListener {
  public:
   virtual void on_scan_end() {}
+  /// Whether parse_device() could handle this advertisement. Checked before the advertisement is parsed, listeners
+  /// that only handle specific devices should override it so that other advertisements aren't parsed for them.
+  virtual bool accepts_advertisement(const AdvertisementView &advertisement) { return true; }
   virtual bool parse_device(const ESPBTDevice &device) = 0;
   virtual bool parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_param *advertisements, size_t count) {
     return false;
@@ -133,6 +138,18 @@ class ESPBTDeviceListener {
   ESP32BLETracker *parent_{nullptr};
 };
 
+/// Listener for the advertisements of a single device, selected with set_address().
+class ESPBTDeviceAddressListener : public ESPBTDeviceListener {
+ public:
+  void set_address(uint64_t address) { this->address_ = address; }
+  bool accepts_advertisement(const AdvertisementView &advertisement) override {
+    return advertisement.get_address() == this->address_;
+  }
+
+ protected:
+  uint64_t address_{0};
+};
+
 enum class ClientState {
   // Connection is allocated
   INIT,
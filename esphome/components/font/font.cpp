@@ -1,5 +1,6 @@
 #include "font.h"
 
+#include "esphome/core/application.h"
 #include "esphome/core/color.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -139,6 +140,8 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     auto b_b = (float) background.b;
     auto b_w = (float) background.w;
     for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
+      // Fully set pixels are drawn as horizontal runs, so clipping and rotation are resolved once per run
+      int run_x = max_x;
       for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
         uint8_t pixel = 0;
         for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
@@ -152,15 +155,25 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
           bitmask >>= 1;
         }
         if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
+          if (run_x == max_x)
+            run_x = glyph_x;
+          continue;
+        }
+        if (run_x != max_x) {
+          display->horizontal_line(run_x, glyph_y, glyph_x - run_x, color);
+          run_x = max_x;
+        }
+        if (pixel != 0) {
           auto on = (float) pixel / (float) bpp_max;
           auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
                                (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
           display->draw_pixel_at(glyph_x, glyph_y, blended);
         }
       }
+      if (run_x != max_x)
+        display->horizontal_line(run_x, glyph_y, max_x - run_x, color);
     }
+    App.feed_wdt();
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
     i += match_length;
@@ -1,5 +1,6 @@
 #include "graph.h"
 #include "esphome/components/display/display.h"
+#include "esphome/core/application.h"
 #include "esphome/core/color.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
@@ -142,6 +143,7 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
       for (uint32_t x = 0; x < this->width_; x += 2) {
         buff->draw_pixel_at(x_offset + x, y_offset + py, color);
       }
+      App.feed_wdt();
     }
   }
   if (!std::isnan(this->gridspacing_x_) && (this->gridspacing_x_ > 0)) {
@@ -157,6 +159,7 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
       for (uint32_t y = 0; y < this->height_; y += 2) {
         buff->draw_pixel_at(x_offset + i * (this->width_ - 1) / n, y_offset + y, color);
       }
+      App.feed_wdt();
     }
   }
 
@@ -207,6 +210,7 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
         has_prev = false;
       }
     }
+    App.feed_wdt();
   }
 }
 
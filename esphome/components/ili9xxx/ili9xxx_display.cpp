@@ -4,6 +4,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace ili9xxx {
 
@@ -57,10 +59,6 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -71,7 +69,9 @@ void ILI9XXXDisplay::alloc_buffer_() {
   }
   if (this->buffer_ == nullptr) {
     this->mark_failed();
+    return;
   }
+  this->init_dirty_tiles_();
 }
 
 void ILI9XXXDisplay::setup_pins_() {
@@ -129,10 +129,7 @@ void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->mark_all_dirty_();
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
@@ -191,16 +188,54 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     this->buffer_[pos] = new_color;
     updated = true;
   }
-  if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+  // only the tiles that changed have to be sent to the display
+  if (updated)
+    this->mark_dirty_(x, y);
+}
+
+void HOT ILI9XXXDisplay::filled_absolute_rectangle_internal(int x1, int y1, int width, int height, Color color) {
+  if (!this->check_buffer_())
+    return;
+  uint16_t new_color;
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      break;
+    case BITS_16:
+      new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+      break;
+    default:
+      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      break;
+  }
+  const uint8_t high = new_color >> 8;
+  const uint8_t low = new_color & 0xFF;
+  const bool wide = this->buffer_color_mode_ == BITS_16;
+
+  // Like draw_absolute_pixel_internal(), only mark the pixels that actually changed as dirty
+  for (int y = y1; y < y1 + height; y++) {
+    uint32_t pos = y * this->width_ + x1;
+    int row_x1 = -1, row_x2 = -1;
+    for (int x = x1; x < x1 + width; x++, pos++) {
+      bool updated;
+      if (wide) {
+        uint8_t *pixel = this->buffer_ + pos * 2;
+        updated = pixel[0] != high || pixel[1] != low;
+        pixel[0] = high;
+        pixel[1] = low;
+      } else {
+        updated = this->buffer_[pos] != low;
+        this->buffer_[pos] = low;
+      }
+      if (updated) {
+        if (row_x1 < 0)
+          row_x1 = x;
+        row_x2 = x;
+      }
+    }
+    if (row_x1 >= 0)
+      this->mark_dirty_(row_x1, y, row_x2, y);
+    App.feed_wdt();
   }
 }
 
@@ -220,13 +255,17 @@ void ILI9XXXDisplay::update() {
 
 void ILI9XXXDisplay::display_() {
   // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
+  if (!this->has_dirty_tiles_()) {
     return;
   }
+  auto now = millis();
+  this->flush_dirty_regions_([this](int x1, int y1, int x2, int y2) { this->write_region_(x1, y1, x2, y2); });
+  ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
+}
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+void ILI9XXXDisplay::write_region_(int x1, int y1, int x2, int y2) {
+  size_t const w = x2 - x1 + 1;
+  size_t const h = y2 - y1 + 1;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -234,24 +273,22 @@ void ILI9XXXDisplay::display_() {
   // estimate time for multiple writes
   size_t mw_time = (w * h * 16) / mhz + w * h * 2 / ILI9XXX_TRANSFER_BUFFER_SIZE * SPI_SETUP_US;
   ESP_LOGV(TAG,
-           "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
+           "Start display(x1:%d, y1:%d, x2:%d, y2:%d, width:%zu, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
-  auto now = millis();
+           x1, y1, x2, y2, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y1, this->width_ - 1, y2);
+    this->write_array(this->buffer_ + y1 * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x1, y1, x2, y2);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y1 * this->width_ + x1;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -292,12 +329,6 @@ void ILI9XXXDisplay::display_() {
     }
   }
   this->end_data_();
-  ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
@@ -1,71 +1,93 @@
 #include "image.h"
 
+#include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 
 namespace esphome {
 namespace image {
 
+/// Pixels collected before a run of drawn pixels is handed to the display.
+static const int IMAGE_SPAN_LENGTH = 32;
+
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      for (int img_y = 0; img_y < height_; img_y++) {
+        // Draw runs of equal pixels as horizontal lines, so clipping and rotation are resolved once per run
+        int run_x = 0;
+        bool run_on = this->get_binary_pixel_(0, img_y);
+        for (int img_x = 1; img_x <= width_; img_x++) {
+          const bool on = img_x < width_ && this->get_binary_pixel_(img_x, img_y);
+          if (img_x < width_ && on == run_on)
+            continue;
+          if (run_on) {
+            display->horizontal_line(x + run_x, y + img_y, img_x - run_x, color_on);
           } else if (!this->transparency_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
+            display->horizontal_line(x + run_x, y + img_y, img_x - run_x, color_off);
           }
+          run_x = img_x;
+          run_on = on;
         }
       }
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          const uint32_t pos = (img_x + img_y * this->width_);
-          const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
-          Color color = Color(gray, gray, gray, 0xFF);
-          switch (this->transparency_) {
-            case TRANSPARENCY_CHROMA_KEY:
-              if (gray == 1) {
-                continue;  // skip drawing
-              }
-              break;
-            case TRANSPARENCY_ALPHA_CHANNEL: {
-              auto on = (float) gray / 255.0f;
-              auto off = 1.0f - on;
-              // blend color_on and color_off
-              color = Color(color_on.r * on + color_off.r * off, color_on.g * on + color_off.g * off,
-                            color_on.b * on + color_off.b * off, 0xFF);
-              break;
-            }
-            default:
-              break;
-          }
-          display->draw_pixel_at(x + img_x, y + img_y, color);
-        }
-      }
-      break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
+    case IMAGE_TYPE_RGB: {
+      // Draw runs of drawn pixels as rows, so clipping and rotation are resolved once per run
+      Color span[IMAGE_SPAN_LENGTH];
+      for (int img_y = 0; img_y < height_; img_y++) {
+        int span_x = 0;
+        int span_length = 0;
+        for (int img_x = 0; img_x < width_; img_x++) {
+          const bool drawn = this->get_draw_color_(img_x, img_y, color_on, color_off, &span[span_length]);
+          if (drawn && span_length++ == 0)
+            span_x = img_x;
+          if (span_length != 0 && (!drawn || span_length == IMAGE_SPAN_LENGTH)) {
+            display->draw_row(x + span_x, y + img_y, span_length, span);
+            span_length = 0;
           }
         }
+        if (span_length != 0)
+          display->draw_row(x + span_x, y + img_y, span_length, span);
+        App.feed_wdt();
       }
       break;
-    case IMAGE_TYPE_RGB:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
+    }
+  }
+}
+bool Image::get_draw_color_(int x, int y, Color color_on, Color color_off, Color *color) const {
+  switch (this->type_) {
+    case IMAGE_TYPE_GRAYSCALE: {
+      const uint32_t pos = (x + y * this->width_);
+      const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+      switch (this->transparency_) {
+        case TRANSPARENCY_CHROMA_KEY:
+          if (gray == 1)
+            return false;  // skip drawing
+          break;
+        case TRANSPARENCY_ALPHA_CHANNEL: {
+          auto on = (float) gray / 255.0f;
+          auto off = 1.0f - on;
+          // blend color_on and color_off
+          *color = Color(color_on.r * on + color_off.r * off, color_on.g * on + color_off.g * off,
+                         color_on.b * on + color_off.b * off, 0xFF);
+          return true;
         }
+        default:
+          break;
       }
-      break;
+      *color = Color(gray, gray, gray, 0xFF);
+      return true;
+    }
+    case IMAGE_TYPE_RGB565:
+      *color = this->get_rgb565_pixel_(x, y);
+      return color->w >= 0x80;
+    case IMAGE_TYPE_RGB:
+      *color = this->get_rgb_pixel_(x, y);
+      return color->w >= 0x80;
+    default:
+      return false;
   }
 }
 Color Image::get_pixel(int x, int y, const Color color_on, const Color color_off) const {
@@ -48,6 +48,8 @@ class Image : public display::BaseImage {
   Color get_rgb_pixel_(int x, int y) const;
   Color get_rgb565_pixel_(int x, int y) const;
   Color get_grayscale_pixel_(int x, int y) const;
+  /// The color to draw a grayscale or color pixel with, false if it is transparent and has to be skipped.
+  bool get_draw_color_(int x, int y, Color color_on, Color color_off, Color *color) const;
 
   int width_;
   int height_;
@@ -9,10 +9,8 @@
 namespace esphome {
 namespace inkbird_ibsth1_mini {
 
-class InkbirdIbstH1Mini : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class InkbirdIbstH1Mini : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 
   void dump_config() override;
@@ -23,7 +21,6 @@ class InkbirdIbstH1Mini : public Component, public esp32_ble_tracker::ESPBTDevic
   void set_battery_level(sensor::Sensor *battery_level) { battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *external_temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
@@ -0,0 +1,175 @@
+#include "json_writer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+void JsonWriter::clear() {
+  this->buffer_.clear();
+  this->first_ = true;
+}
+
+void JsonWriter::begin_object() {
+  this->separator_();
+  this->buffer_ += '{';
+  this->first_ = true;
+}
+void JsonWriter::begin_object(const char *key) {
+  this->key_(key);
+  this->buffer_ += '{';
+  this->first_ = true;
+}
+void JsonWriter::end_object() {
+  this->buffer_ += '}';
+  this->first_ = false;
+}
+void JsonWriter::begin_array() {
+  this->separator_();
+  this->buffer_ += '[';
+  this->first_ = true;
+}
+void JsonWriter::begin_array(const char *key) {
+  this->key_(key);
+  this->buffer_ += '[';
+  this->first_ = true;
+}
+void JsonWriter::end_array() {
+  this->buffer_ += ']';
+  this->first_ = false;
+}
+
+void JsonWriter::add(const char *key, const char *value) {
+  this->key_(key);
+  this->string_(value, strlen(value));
+}
+void JsonWriter::add(const char *key, const StringRef &value) {
+  this->key_(key);
+  this->string_(value.c_str(), value.size());
+}
+void JsonWriter::add(const char *key, bool value) {
+  this->key_(key);
+  this->buffer_ += value ? "true" : "false";
+}
+void JsonWriter::add(const char *key, float value) {
+  this->key_(key);
+  // Only the digits a float carries, 0.3f is written as 0.3 and not as 0.300000012
+  this->number_(value, 7);
+}
+void JsonWriter::add(const char *key, double value) {
+  this->key_(key);
+  this->number_(value, 9);
+}
+void JsonWriter::add_concat(const char *key, const char *first, const char *second) {
+  this->key_(key);
+  this->buffer_ += '"';
+  this->escaped_(first, strlen(first));
+  this->escaped_(second, strlen(second));
+  this->buffer_ += '"';
+}
+void JsonWriter::add_null(const char *key) {
+  this->key_(key);
+  this->buffer_ += "null";
+}
+
+void JsonWriter::add(const char *value) {
+  this->separator_();
+  this->string_(value, strlen(value));
+}
+void JsonWriter::add(const StringRef &value) {
+  this->separator_();
+  this->string_(value.c_str(), value.size());
+}
+
+void JsonWriter::key_(const char *key) {
+  this->separator_();
+  this->string_(key, strlen(key));
+  this->buffer_ += ':';
+}
+
+void JsonWriter::string_(const char *value, size_t len) {
+  this->buffer_ += '"';
+  this->escaped_(value, len);
+  this->buffer_ += '"';
+}
+void JsonWriter::escaped_(const char *value, size_t len) {
+  size_t run_start = 0;
+  for (size_t i = 0; i < len; i++) {
+    const auto c = static_cast<uint8_t>(value[i]);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Copy everything that needs no escaping in one go
+    this->buffer_.append(value + run_start, i - run_start);
+    run_start = i + 1;
+    this->buffer_ += '\\';
+    switch (c) {
+      case '"':
+      case '\\':
+        this->buffer_ += static_cast<char>(c);
+        break;
+      case '\b':
+        this->buffer_ += 'b';
+        break;
+      case '\f':
+        this->buffer_ += 'f';
+        break;
+      case '\n':
+        this->buffer_ += 'n';
+        break;
+      case '\r':
+        this->buffer_ += 'r';
+        break;
+      case '\t':
+        this->buffer_ += 't';
+        break;
+      default:
+        char buf[6];
+        snprintf(buf, sizeof(buf), "u%04x", c);
+        this->buffer_.append(buf, 5);
+        break;
+    }
+  }
+  this->buffer_.append(value + run_start, len - run_start);
+}
+
+void JsonWriter::number_(double value, int precision) {
+  if (!std::isfinite(value)) {
+    this->buffer_ += "null";
+    return;
+  }
+  char buf[24];
+  const int len = snprintf(buf, sizeof(buf), "%.*g", precision, value);
+  this->buffer_.append(buf, len);
+}
+
+void JsonWriter::signed_(int64_t value) {
+  if (value < 0) {
+    this->buffer_ += '-';
+    // Negate in unsigned arithmetic, -INT64_MIN doesn't fit into int64_t
+    this->unsigned_(~static_cast<uint64_t>(value) + 1);
+  } else {
+    this->unsigned_(value);
+  }
+}
+
+void JsonWriter::unsigned_(uint64_t value) {
+  char buf[20];
+  char *end = buf + sizeof(buf);
+  char *pos = end;
+  // 64-bit division is slow on 32-bit targets, switch to 32 bits as soon as the value fits
+  while (value > UINT32_MAX) {
+    *--pos = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  auto small = static_cast<uint32_t>(value);
+  do {
+    *--pos = static_cast<char>('0' + small % 10);
+    small /= 10;
+  } while (small != 0);
+  this->buffer_.append(pos, end - pos);
+}
+
+}  // namespace json
+}  // namespace esphome
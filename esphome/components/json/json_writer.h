@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
+
+namespace esphome {
+namespace json {
+
+/** Writes JSON straight into a text buffer, without building a document first.
+ *
+ * Unlike build_json() no JsonDocument has to be sized and allocated per message, and the buffer is kept: clear()
+ * retains its capacity, so once it has grown to the size of the largest message, writing a message doesn't allocate.
+ * Members are written in the order they are added and commas are inserted automatically. NaN and infinite numbers
+ * are written as null.
+ */
+class JsonWriter {
+ public:
+  /// Discard the current message, keeping the allocated buffer.
+  void clear();
+
+  void begin_object();
+  void begin_object(const char *key);
+  void end_object();
+  void begin_array();
+  void begin_array(const char *key);
+  void end_array();
+
+  /// Add a member to the current object.
+  void add(const char *key, const char *value);
+  void add(const char *key, const std::string &value) { this->add(key, StringRef(value)); }
+  void add(const char *key, const StringRef &value);
+  void add(const char *key, bool value);
+  void add(const char *key, float value);
+  void add(const char *key, double value);
+  template<typename T, enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value, int> = 0>
+  void add(const char *key, T value) {
+    this->key_(key);
+    this->integer_(value);
+  }
+  /// Add a string member that consists of two parts, e.g. a prefix and an id, without concatenating them first.
+  void add_concat(const char *key, const char *first, const char *second);
+  void add_null(const char *key);
+
+  /// Add an element to the current array.
+  void add(const char *value);
+  void add(const std::string &value) { this->add(StringRef(value)); }
+  void add(const StringRef &value);
+
+  const char *c_str() const { return this->buffer_.c_str(); }
+  size_t size() const { return this->buffer_.size(); }
+  const std::string &str() const { return this->buffer_; }
+
+ protected:
+  void separator_() {
+    if (!this->first_)
+      this->buffer_ += ',';
+    this->first_ = false;
+  }
+  void key_(const char *key);
+  void string_(const char *value, size_t len);
+  /// Append a string without the surrounding quotes, escaping what JSON requires.
+  void escaped_(const char *value, size_t len);
+  /// Append a number with the given significant digits, or null if it isn't finite.
+  void number_(double value, int precision);
+  template<typename T, enable_if_t<std::is_enum<T>::value, int> = 0> void integer_(T value) {
+    this->signed_(static_cast<int64_t>(value));
+  }
+  template<typename T, enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, int> = 0>
+  void integer_(T value) {
+    this->signed_(value);
+  }
+  template<typename T, enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, int> = 0>
+  void integer_(T value) {
+    this->unsigned_(value);
+  }
+  void signed_(int64_t value);
+  void unsigned_(uint64_t value);
+
+  std::string buffer_;
+  /// Whether no member has been added to the innermost open object or array yet.
+  bool first_{true};
+};
+
+}  // namespace json
+}  // namespace esphome
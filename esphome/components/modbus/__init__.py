@@ -6,24 +6,34 @@ import esphome.config_validation as cv
 import esphome.final_validate as fv
 from esphome.cpp_helpers import gpio_pin_expression
 from esphome.components import uart
+from esphome.components.socket import (
+    CONF_IMPLEMENTATION,
+    IMPLEMENTATION_BSD_SOCKETS,
+    IMPLEMENTATION_LWIP_SOCKETS,
+    IMPLEMENTATION_LWIP_TCP,
+)
 from esphome.const import (
     CONF_FLOW_CONTROL_PIN,
     CONF_ID,
     CONF_ADDRESS,
     CONF_DISABLE_CRC,
+    CONF_PORT,
 )
+from esphome.core import CORE
 from esphome import pins
 
-DEPENDENCIES = ["uart"]
-
 modbus_ns = cg.esphome_ns.namespace("modbus")
 Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice)
+ModbusTCP = modbus_ns.class_("ModbusTCP", Modbus)
 ModbusDevice = modbus_ns.class_("ModbusDevice")
 MULTI_CONF = True
 
 CONF_ROLE = "role"
 CONF_MODBUS_ID = "modbus_id"
 CONF_SEND_WAIT_TIME = "send_wait_time"
+CONF_TRANSPORT = "transport"
+CONF_HOST = "host"
+CONF_MAX_TRANSACTIONS = "max_transactions"
 
 ModbusRole = modbus_ns.enum("ModbusRole")
 MODBUS_ROLES = {
@@ -31,29 +41,111 @@ MODBUS_ROLES = {
     "server": ModbusRole.SERVER,
 }
 
-CONFIG_SCHEMA = (
-    cv.Schema(
-        {
-            cv.GenerateID(): cv.declare_id(Modbus),
-            cv.Optional(CONF_ROLE, default="client"): cv.enum(MODBUS_ROLES),
-            cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
-            cv.Optional(
-                CONF_SEND_WAIT_TIME, default="250ms"
-            ): cv.positive_time_period_milliseconds,
-            cv.Optional(CONF_DISABLE_CRC, default=False): cv.boolean,
-        }
-    )
-    .extend(cv.COMPONENT_SCHEMA)
-    .extend(uart.UART_DEVICE_SCHEMA)
+TRANSPORT_UART = "uart"
+TRANSPORT_TCP = "tcp"
+TRANSPORT_RTU_OVER_TCP = "rtu_over_tcp"
+
+
+def AUTO_LOAD():
+    # the socket component is only compiled in if a bus uses one of the TCP transports
+    configs = CORE.raw_config.get("modbus") or []
+    if not isinstance(configs, list):
+        configs = [configs]
+    for conf in configs:
+        if (
+            isinstance(conf, dict)
+            and str(conf.get(CONF_TRANSPORT, TRANSPORT_UART)).lower() != TRANSPORT_UART
+        ):
+            return ["socket", "uart"]
+    return ["uart"]
+
+
+ModbusTCPTransport = modbus_ns.enum("ModbusTCPTransport")
+MODBUS_TCP_TRANSPORTS = {
+    TRANSPORT_TCP: ModbusTCPTransport.MODBUS_TRANSPORT_TCP,
+    TRANSPORT_RTU_OVER_TCP: ModbusTCPTransport.MODBUS_TRANSPORT_RTU_OVER_TCP,
+}
+
+BASE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(
+            CONF_SEND_WAIT_TIME, default="250ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_DISABLE_CRC, default=False): cv.boolean,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+UART_SCHEMA = BASE_SCHEMA.extend(
+    {
+        cv.GenerateID(): cv.declare_id(Modbus),
+        cv.Optional(CONF_ROLE, default="client"): cv.enum(MODBUS_ROLES),
+        cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
+    }
+).extend(uart.UART_DEVICE_SCHEMA)
+
+TCP_SCHEMA = BASE_SCHEMA.extend(
+    {
+        cv.GenerateID(): cv.declare_id(ModbusTCP),
+        # only the client side is implemented for TCP
+        cv.Optional(CONF_ROLE, default="client"): cv.All(
+            cv.one_of("client", lower=True), cv.enum(MODBUS_ROLES)
+        ),
+        cv.Required(CONF_HOST): cv.ipv4address,
+        cv.Optional(CONF_PORT, default=502): cv.port,
+    }
+)
+
+CONFIG_SCHEMA = cv.typed_schema(
+    {
+        TRANSPORT_UART: UART_SCHEMA,
+        TRANSPORT_TCP: TCP_SCHEMA.extend(
+            {
+                cv.Optional(CONF_MAX_TRANSACTIONS, default=4): cv.int_range(
+                    min=1, max=32
+                ),
+            }
+        ),
+        TRANSPORT_RTU_OVER_TCP: TCP_SCHEMA,
+    },
+    key=CONF_TRANSPORT,
+    default_type=TRANSPORT_UART,
+    lower=True,
 )
 
 
+def _final_validate(config):
+    if config[CONF_TRANSPORT] == TRANSPORT_UART:
+        return config
+    full_config = fv.full_config.get()
+    transport = config[CONF_TRANSPORT]
+    if "network" not in full_config:
+        raise cv.Invalid(f"Transport {transport} requires a network connection")
+    # the raw TCP socket implementation can't open outgoing connections
+    if full_config["socket"][CONF_IMPLEMENTATION] == IMPLEMENTATION_LWIP_TCP:
+        raise cv.Invalid(
+            f"Transport {transport} requires socket implementation "
+            f"{IMPLEMENTATION_LWIP_SOCKETS} or {IMPLEMENTATION_BSD_SOCKETS}"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     cg.add_global(modbus_ns.using)
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
-    await uart.register_uart_device(var, config)
+    if config[CONF_TRANSPORT] == TRANSPORT_UART:
+        await uart.register_uart_device(var, config)
+    else:
+        cg.add_define("USE_MODBUS_TCP")
+        cg.add(var.set_host(str(config[CONF_HOST])))
+        cg.add(var.set_port(config[CONF_PORT]))
+        cg.add(var.set_transport(MODBUS_TCP_TRANSPORTS[config[CONF_TRANSPORT]]))
+        if CONF_MAX_TRANSACTIONS in config:
+            cg.add(var.set_max_transactions(config[CONF_MAX_TRANSACTIONS]))
 
     cg.add(var.set_role(config[CONF_ROLE]))
     if CONF_FLOW_CONTROL_PIN in config:
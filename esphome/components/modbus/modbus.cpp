@@ -15,18 +15,13 @@ void Modbus::setup() {
 void Modbus::loop() {
   const uint32_t now = millis();
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
-    } else {
-      size_t at = this->rx_buffer_.size();
-      if (at > 0) {
-        ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse failed", at);
-        this->rx_buffer_.clear();
-      }
-    }
+  uint8_t buf[64];
+  size_t len;
+  while ((len = this->read_available(buf, sizeof(buf))) > 0) {
+    ESP_LOGVV(TAG, "Modbus received %s", format_hex_pretty(buf, len).c_str());
+    this->rx_buffer_.insert(this->rx_buffer_.end(), buf, buf + len);
+    this->last_modbus_byte_ = now;
+    this->parse_modbus_buffer_();
   }
 
   if (now - this->last_modbus_byte_ > 50) {
@@ -44,78 +39,101 @@ void Modbus::loop() {
       waiting_for_response = 0;
     }
   }
+
+  this->send_pending_commands_();
+}
+
+bool Modbus::can_send_() const {
+  // a partial frame in the buffer means another device is still talking
+  return this->waiting_for_response == 0 && this->rx_buffer_.empty();
+}
+
+void Modbus::send_pending_commands_() {
+  for (auto *device : this->devices_)
+    device->had_turn_ = false;
+
+  const size_t count = this->devices_.size();
+  while (this->can_send_()) {
+    ModbusDevice *next = nullptr;
+    size_t next_index = 0;
+    uint32_t next_deadline = 0;
+    for (size_t i = 0; i < count; i++) {
+      size_t index = (this->next_device_ + i) % count;
+      ModbusDevice *device = this->devices_[index];
+      uint32_t deadline;
+      if (device->had_turn_ || this->is_waiting_for_response(device->address_) ||
+          !device->get_pending_command_deadline(deadline))
+        continue;
+      // compare the difference so that deadlines around the millis() overflow keep their order
+      if (next == nullptr || static_cast<int32_t>(deadline - next_deadline) < 0) {
+        next = device;
+        next_index = index;
+        next_deadline = deadline;
+      }
+    }
+    if (next == nullptr)
+      break;
+    next->had_turn_ = true;
+    if (next->send_pending_command())
+      this->next_device_ = (next_index + 1) % count;
+  }
+}
+
+void Modbus::parse_modbus_buffer_() {
+  size_t start = 0;
+  while (start < this->rx_buffer_.size()) {
+    size_t frame_len = this->parse_modbus_frame_(&this->rx_buffer_[start], this->rx_buffer_.size() - start);
+    if (frame_len == 0)
+      break;
+    start += frame_len;
+  }
+  // keep the incomplete frame at the start of the buffer until more bytes arrive
+  this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + start);
 }
 
-bool Modbus::parse_modbus_byte_(uint8_t byte) {
-  size_t at = this->rx_buffer_.size();
-  this->rx_buffer_.push_back(byte);
-  const uint8_t *raw = &this->rx_buffer_[0];
-  ESP_LOGVV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
+size_t Modbus::parse_modbus_frame_(const uint8_t *raw, size_t len) {
   // Byte 0: modbus address (match all)
-  if (at == 0)
-    return true;
-  uint8_t address = raw[0];
-  uint8_t function_code = raw[1];
   // Byte 2: Size (with modbus rtu function code 4/3)
   // See also https://en.wikipedia.org/wiki/Modbus
-  if (at == 2)
-    return true;
+  if (len < 3)
+    return 0;
+  uint8_t function_code = raw[1];
 
-  uint8_t data_len = raw[2];
-  uint8_t data_offset = 3;
+  uint8_t data_len;
+  uint8_t data_offset;
+  size_t frame_len;
 
-  // Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
-  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
+  if (is_user_defined_function(function_code)) {
     // Handle user-defined function, since we don't know how big this ought to be,
     // ideally we should delegate the entire length detection to whatever handler is
     // installed, but wait, there is the CRC, and if we get a hit there is a good
     // chance that this is a complete message ... admittedly there is a small chance is
     // isn't but that is quite small given the purpose of the CRC in the first place
 
-    // Fewer than 2 bytes can't calc CRC
-    if (at < 2)
-      return true;
-
-    data_len = at - 2;
+    // Take the shortest frame ending in a matching CRC, the CRC is extended one byte at a time
     data_offset = 1;
-
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-
-    if (computed_crc != remote_crc)
-      return true;
+    uint16_t computed_crc = crc16(raw, data_offset + 1);
+    for (frame_len = data_offset + 3;; frame_len++) {
+      if (frame_len > len || frame_len - 3 > 0xFF)
+        return 0;
+      uint16_t remote_crc = uint16_t(raw[frame_len - 2]) | (uint16_t(raw[frame_len - 1]) << 8);
+      if (computed_crc == remote_crc)
+        break;
+      computed_crc = crc16(raw + frame_len - 2, 1, computed_crc);
+    }
+    data_len = frame_len - 3;
 
     ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
 
   } else {
-    // data starts at 2 and length is 4 for read registers commands
-    if (this->role == ModbusRole::SERVER && (function_code == 0x3 || function_code == 0x4)) {
-      data_offset = 2;
-      data_len = 4;
-    }
-
-    // the response for write command mirrors the requests and data starts at offset 2 instead of 3 for read commands
-    if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
-      data_offset = 2;
-      data_len = 4;
-    }
-
-    // Error ( msb indicates error )
-    // response format:  Byte[0] = device address, Byte[1] function code | 0x80 , Byte[2] exception code, Byte[3-4] crc
-    if ((function_code & 0x80) == 0x80) {
-      data_offset = 2;
-      data_len = 1;
-    }
+    this->get_data_layout_(raw, data_offset, data_len);
 
     // Byte data_offset..data_offset+data_len-1: Data
-    if (at < data_offset + data_len)
-      return true;
+    // Byte data_offset+data_len..data_offset+data_len+1: CRC (over all bytes)
+    frame_len = data_offset + data_len + 2;
+    if (len < frame_len)
+      return 0;
 
-    // Byte 3+data_len: CRC_LO (over all bytes)
-    if (at == data_offset + data_len)
-      return true;
-
-    // Byte data_offset+len+1: CRC_HI (over all bytes)
     uint16_t computed_crc = crc16(raw, data_offset + data_len);
     uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
     if (computed_crc != remote_crc) {
@@ -123,18 +141,54 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
         ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", computed_crc, remote_crc);
       } else {
         ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
-        return false;
+        ESP_LOGV(TAG, "Clearing buffer of %zu bytes - parse failed", frame_len);
+        return frame_len;
       }
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+  this->dispatch_modbus_frame_(raw, data_offset, data_len);
+  waiting_for_response = 0;
+
+  ESP_LOGV(TAG, "Clearing buffer of %zu bytes - parse succeeded", frame_len);
+  return frame_len;
+}
+
+void Modbus::get_data_layout_(const uint8_t *raw, uint8_t &data_offset, uint8_t &data_len) const {
+  uint8_t function_code = raw[1];
+  data_offset = 3;
+  data_len = raw[2];
+
+  // data starts at 2 and length is 4 for read registers commands
+  if (this->role == ModbusRole::SERVER && (function_code == 0x3 || function_code == 0x4)) {
+    data_offset = 2;
+    data_len = 4;
+  }
+
+  // the response for write command mirrors the requests and data starts at offset 2 instead of 3 for read commands
+  if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
+    data_offset = 2;
+    data_len = 4;
+  }
+
+  // Error ( msb indicates error )
+  // response format:  Byte[0] = device address, Byte[1] function code | 0x80 , Byte[2] exception code, Byte[3-4] crc
+  if ((function_code & 0x80) == 0x80) {
+    data_offset = 2;
+    data_len = 1;
+  }
+}
+
+void Modbus::dispatch_modbus_frame_(const uint8_t *raw, uint8_t data_offset, uint8_t data_len) {
+  uint8_t address = raw[0];
+  uint8_t function_code = raw[1];
+  std::vector<uint8_t> data(raw + data_offset, raw + data_offset + data_len);
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
       // Is it an error response?
       if ((function_code & 0x80) == 0x80) {
         ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
-        if (waiting_for_response != 0) {
+        if (this->is_waiting_for_response(address)) {
           device->on_modbus_error(function_code & 0x7F, raw[2]);
         } else {
           // Ignore modbus exception not related to a pending command
@@ -149,16 +203,10 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       found = true;
     }
   }
-  waiting_for_response = 0;
 
   if (!found) {
     ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", address);
   }
-
-  // reset buffer
-  ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse succeeded", at);
-  this->rx_buffer_.clear();
-  return true;
 }
 
 void Modbus::dump_config() {
@@ -206,18 +254,7 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
     }
   }
 
-  auto crc = crc16(data.data(), data.size());
-  data.push_back(crc >> 0);
-  data.push_back(crc >> 8);
-
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(true);
-
-  this->write_array(data);
-  this->flush();
-
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(false);
+  this->write_frame_(data);
   waiting_for_response = address;
   last_send_ = millis();
   ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(data).c_str());
@@ -230,19 +267,26 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
     return;
   }
 
+  std::vector<uint8_t> frame(payload);
+  this->write_frame_(frame);
+  waiting_for_response = payload[0];
+  ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
+  last_send_ = millis();
+}
+
+void Modbus::write_frame_(std::vector<uint8_t> &frame) {
+  auto crc = crc16(frame.data(), frame.size());
+  frame.push_back(crc >> 0);
+  frame.push_back(crc >> 8);
+
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(true);
 
-  auto crc = crc16(payload.data(), payload.size());
-  this->write_array(payload);
-  this->write_byte(crc & 0xFF);
-  this->write_byte((crc >> 8) & 0xFF);
+  this->write_array(frame);
   this->flush();
+
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
-  waiting_for_response = payload[0];
-  ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
-  last_send_ = millis();
 }
 
 }  // namespace modbus
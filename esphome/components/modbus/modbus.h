@@ -37,19 +37,45 @@ class Modbus : public uart::UARTDevice, public Component {
   uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
   void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+  /// Whether a request to the device with the given address is waiting for its response.
+  virtual bool is_waiting_for_response(uint8_t address) const { return this->waiting_for_response != 0; }
 
   ModbusRole role;
 
  protected:
   GPIOPin *flow_control_pin_{nullptr};
 
-  bool parse_modbus_byte_(uint8_t byte);
+  /// Parse and dispatch all complete frames in rx_buffer_, leaving an incomplete frame at its start.
+  void parse_modbus_buffer_();
+  /// Parse the frame at the start of raw, return its length or 0 if it is incomplete.
+  size_t parse_modbus_frame_(const uint8_t *raw, size_t len);
+  /// Get the position of the data in a frame with a standard function code, raw must hold at least 3 bytes.
+  void get_data_layout_(const uint8_t *raw, uint8_t &data_offset, uint8_t &data_len) const;
+  /// Pass the data of a checked frame to the devices with its address.
+  void dispatch_modbus_frame_(const uint8_t *raw, uint8_t data_offset, uint8_t data_len);
+  /// Complete a frame holding address, function code and data for the transport and send it.
+  virtual void write_frame_(std::vector<uint8_t> &frame);
+  /// Whether the transport can take another request.
+  virtual bool can_send_() const;
+  /** Let the devices send their queued commands while the transport can take them.
+   *
+   * The device whose next command has the earliest deadline goes first, devices with the same deadline take turns
+   * starting after the device that sent last. Each device gets at most one turn per call, so a device that is
+   * throttled or waiting for its response doesn't block the others.
+   */
+  void send_pending_commands_();
+  static bool is_user_defined_function(uint8_t function_code) {
+    // Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
+    return (function_code >= 65 && function_code <= 72) || (function_code >= 100 && function_code <= 110);
+  }
   uint16_t send_wait_time_{250};
   bool disable_crc_;
   std::vector<uint8_t> rx_buffer_;
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
+  /// Index into devices_ of the device that gets the next turn if deadlines are equal.
+  size_t next_device_{0};
 };
 
 class ModbusDevice {
@@ -65,13 +91,19 @@ class ModbusDevice {
   }
   void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
   // If more than one device is connected block sending a new command before a response is received
-  bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  bool waiting_for_response() { return parent_->is_waiting_for_response(this->address_); }
+  /// Get the deadline in millis() of the next queued command, return false if no command is queued.
+  virtual bool get_pending_command_deadline(uint32_t &deadline) { return false; }
+  /// Called by the bus when it is this device's turn, return whether a command was sent.
+  virtual bool send_pending_command() { return false; }
 
  protected:
   friend Modbus;
 
   Modbus *parent_;
   uint8_t address_;
+  /// Whether this device already had its turn in the current Modbus::send_pending_commands_() call.
+  bool had_turn_{false};
 };
 
 }  // namespace modbus
@@ -0,0 +1,299 @@
+#include "modbus_tcp.h"
+
+#ifdef USE_MODBUS_TCP
+
+#include "esphome/components/network/util.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cerrno>
+
+namespace esphome {
+namespace modbus {
+
+static const char *const TAG = "modbus.tcp";
+
+static const uint32_t RECONNECT_INTERVAL = 5000;
+static const uint32_t CONNECT_TIMEOUT = 5000;
+
+void ModbusTCP::loop() {
+  if (!this->socket_) {
+    bool retry = this->last_connect_attempt_ == 0 || millis() - this->last_connect_attempt_ > RECONNECT_INTERVAL;
+    if (retry && network::is_connected())
+      this->connect_();
+    return;
+  }
+  if (!this->connected_ && !this->check_connected_())
+    return;
+
+  if (!this->read_())
+    return;
+
+  // after read_(), which updates the timestamps that are compared with it
+  const uint32_t now = millis();
+
+  if (this->transport_ == MODBUS_TRANSPORT_TCP) {
+    // Gateways with a serial bus answer one request after the other, so the wait time of a request starts once it is
+    // the oldest one in flight. Responses that didn't arrive in time are dropped by their transaction id.
+    while (!this->transactions_.empty() && now - this->transactions_.front().since > this->send_wait_time_) {
+      ESP_LOGV(TAG, "Stop waiting for response from %d", this->transactions_.front().address);
+      this->finish_transaction_(0);
+    }
+    if (this->transactions_.empty())
+      this->waiting_for_response = 0;
+  } else if (now - this->last_modbus_byte_ > 50) {
+    if (!this->rx_buffer_.empty()) {
+      ESP_LOGV(TAG, "Clearing buffer of %zu bytes - timeout", this->rx_buffer_.size());
+      this->rx_buffer_.clear();
+    }
+    if (now - this->last_send_ > this->send_wait_time_)
+      this->waiting_for_response = 0;
+  }
+
+  this->send_pending_commands_();
+  this->flush_();
+}
+
+bool ModbusTCP::is_waiting_for_response(uint8_t address) const {
+  if (this->transport_ == MODBUS_TRANSPORT_RTU_OVER_TCP)
+    return Modbus::is_waiting_for_response(address);
+  for (const auto &transaction : this->transactions_) {
+    if (transaction.address == address)
+      return true;
+  }
+  return false;
+}
+
+bool ModbusTCP::can_send_() const {
+  if (!this->connected_)
+    return false;
+  if (this->transport_ == MODBUS_TRANSPORT_RTU_OVER_TCP)
+    return this->waiting_for_response == 0 && this->rx_buffer_.empty();
+  return this->transactions_.size() < this->max_transactions_;
+}
+
+void ModbusTCP::write_frame_(std::vector<uint8_t> &frame) {
+  if (!this->connected_) {
+    ESP_LOGW(TAG, "Not connected to %s:%u, dropping request to %d", this->host_.c_str(), this->port_, frame[0]);
+    return;
+  }
+  if (this->transport_ == MODBUS_TRANSPORT_RTU_OVER_TCP) {
+    auto crc = crc16(frame.data(), frame.size());
+    this->tx_buffer_.insert(this->tx_buffer_.end(), frame.begin(), frame.end());
+    this->tx_buffer_.push_back(crc >> 0);
+    this->tx_buffer_.push_back(crc >> 8);
+    return;
+  }
+
+  // MBAP header: transaction id, protocol id 0 and the length of the unit id and PDU that follow
+  uint16_t id = ++this->last_transaction_id_;
+  const uint8_t header[MBAP_HEADER_SIZE] = {
+      uint8_t(id >> 8), uint8_t(id >> 0), 0, 0, uint8_t(frame.size() >> 8), uint8_t(frame.size() >> 0),
+  };
+  this->tx_buffer_.insert(this->tx_buffer_.end(), header, header + MBAP_HEADER_SIZE);
+  this->tx_buffer_.insert(this->tx_buffer_.end(), frame.begin(), frame.end());
+  this->transactions_.push_back({id, frame[0], millis()});
+}
+
+void ModbusTCP::connect_() {
+  this->last_connect_attempt_ = millis();
+
+  struct sockaddr_storage server;
+  socklen_t len = socket::set_sockaddr((struct sockaddr *) &server, sizeof(server), this->host_, this->port_);
+  if (len == 0) {
+    ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
+    this->status_set_warning();
+    return;
+  }
+  // monitored so that responses wake the main loop
+  this->socket_ = socket::socket_loop_monitored(server.ss_family, SOCK_STREAM, 0);
+  if (!this->socket_) {
+    ESP_LOGW(TAG, "Could not create socket: errno %d", errno);
+    this->status_set_warning();
+    return;
+  }
+  int err = this->socket_->setblocking(false);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", errno);
+    this->close_();
+    return;
+  }
+  // requests are small and pipelined, don't hold them back until the previous one is acknowledged
+  int enable = 1;
+  err = this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nodelay: errno %d", errno);
+    // we can still continue
+  }
+  err = this->socket_->connect((struct sockaddr *) &server, len);
+  if (err != 0 && errno != EINPROGRESS) {
+    ESP_LOGW(TAG, "Could not connect to %s:%u: errno %d", this->host_.c_str(), this->port_, errno);
+    this->close_();
+    return;
+  }
+  ESP_LOGD(TAG, "Connecting to %s:%u", this->host_.c_str(), this->port_);
+}
+
+bool ModbusTCP::check_connected_() {
+  struct sockaddr_storage peer;
+  socklen_t len = sizeof(peer);
+  if (this->socket_->getpeername((struct sockaddr *) &peer, &len) == 0) {
+    ESP_LOGI(TAG, "Connected to %s:%u", this->host_.c_str(), this->port_);
+    this->connected_ = true;
+    this->status_clear_warning();
+    return true;
+  }
+
+  int error = 0;
+  len = sizeof(error);
+  if (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &error, &len) == 0 && error != 0) {
+    ESP_LOGW(TAG, "Could not connect to %s:%u: errno %d", this->host_.c_str(), this->port_, error);
+    this->close_();
+  } else if (millis() - this->last_connect_attempt_ > CONNECT_TIMEOUT) {
+    ESP_LOGW(TAG, "Could not connect to %s:%u: timeout", this->host_.c_str(), this->port_);
+    this->close_();
+  }
+  return false;
+}
+
+bool ModbusTCP::read_() {
+  uint8_t buf[256];
+  bool received = false;
+  while (true) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        break;
+      ESP_LOGW(TAG, "Reading from %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+      this->close_();
+      return false;
+    }
+    if (len == 0) {
+      ESP_LOGW(TAG, "Connection closed by %s:%u", this->host_.c_str(), this->port_);
+      this->close_();
+      return false;
+    }
+    ESP_LOGVV(TAG, "Modbus received %s", format_hex_pretty(buf, len).c_str());
+    this->rx_buffer_.insert(this->rx_buffer_.end(), buf, buf + len);
+    received = true;
+  }
+  if (!received)
+    return true;
+
+  this->last_modbus_byte_ = millis();
+  if (this->transport_ == MODBUS_TRANSPORT_TCP) {
+    this->parse_mbap_buffer_();
+  } else {
+    this->parse_modbus_buffer_();
+  }
+  // the connection is closed if the stream can't be parsed
+  return this->connected_;
+}
+
+void ModbusTCP::flush_() {
+  if (this->tx_buffer_.empty() || !this->connected_)
+    return;
+  ssize_t written = this->socket_->write(this->tx_buffer_.data(), this->tx_buffer_.size());
+  if (written < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK)
+      return;
+    ESP_LOGW(TAG, "Writing to %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+    this->close_();
+    return;
+  }
+  this->tx_buffer_.erase(this->tx_buffer_.begin(), this->tx_buffer_.begin() + written);
+}
+
+void ModbusTCP::parse_mbap_buffer_() {
+  size_t start = 0;
+  while (this->rx_buffer_.size() - start > MBAP_HEADER_SIZE) {
+    const uint8_t *raw = &this->rx_buffer_[start];
+    uint16_t transaction_id = uint16_t(raw[0]) << 8 | raw[1];
+    uint16_t protocol_id = uint16_t(raw[2]) << 8 | raw[3];
+    // unit id, function code and at least one byte of data, at most the 253 bytes of a PDU
+    uint16_t len = uint16_t(raw[4]) << 8 | raw[5];
+    if (protocol_id != 0 || len < 3 || len > 254) {
+      // without a valid length the start of the next frame can't be found
+      ESP_LOGW(TAG, "Invalid MBAP header %s, reconnecting", format_hex_pretty(raw, MBAP_HEADER_SIZE).c_str());
+      this->close_();
+      return;
+    }
+    if (this->rx_buffer_.size() - start < MBAP_HEADER_SIZE + len)
+      break;
+    this->handle_mbap_frame_(transaction_id, raw + MBAP_HEADER_SIZE, len);
+    start += MBAP_HEADER_SIZE + len;
+  }
+  // keep the incomplete frame at the start of the buffer until more bytes arrive
+  this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + start);
+}
+
+void ModbusTCP::handle_mbap_frame_(uint16_t transaction_id, const uint8_t *raw, uint16_t len) {
+  size_t index = 0;
+  while (index < this->transactions_.size() && this->transactions_[index].id != transaction_id)
+    index++;
+  if (index == this->transactions_.size()) {
+    ESP_LOGD(TAG, "Ignoring response with unknown transaction id %u", transaction_id);
+    return;
+  }
+  if (raw[0] != this->transactions_[index].address) {
+    ESP_LOGW(TAG, "Response to transaction %u from address 0x%02X instead of 0x%02X", transaction_id, raw[0],
+             this->transactions_[index].address);
+    this->finish_transaction_(index);
+    return;
+  }
+
+  uint8_t data_offset;
+  uint8_t data_len;
+  if (is_user_defined_function(raw[1])) {
+    // the length of the frame is known, there is no need to search for the CRC
+    data_offset = 1;
+    data_len = len - 1;
+  } else {
+    this->get_data_layout_(raw, data_offset, data_len);
+    if (data_offset + data_len != len) {
+      ESP_LOGW(TAG, "Response to transaction %u has %u bytes instead of %u", transaction_id, len,
+               data_offset + data_len);
+      this->finish_transaction_(index);
+      return;
+    }
+  }
+  this->dispatch_modbus_frame_(raw, data_offset, data_len);
+  // devices may have sent new requests from their callbacks, those are appended after this transaction
+  this->finish_transaction_(index);
+}
+
+void ModbusTCP::finish_transaction_(size_t index) {
+  this->transactions_.erase(this->transactions_.begin() + index);
+  // the wait time of the next request starts now that it is the oldest
+  if (index == 0 && !this->transactions_.empty())
+    this->transactions_.front().since = millis();
+}
+
+void ModbusTCP::close_() {
+  if (this->socket_) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  this->connected_ = false;
+  this->rx_buffer_.clear();
+  this->tx_buffer_.clear();
+  // requests that were in flight are sent again by their devices after the reconnect
+  this->transactions_.clear();
+  this->waiting_for_response = 0;
+  this->status_set_warning();
+}
+
+void ModbusTCP::dump_config() {
+  ESP_LOGCONFIG(TAG, "Modbus TCP:");
+  ESP_LOGCONFIG(TAG, "  Host: %s:%u", this->host_.c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Transport: %s", this->transport_ == MODBUS_TRANSPORT_TCP ? "TCP" : "RTU over TCP");
+  if (this->transport_ == MODBUS_TRANSPORT_TCP) {
+    ESP_LOGCONFIG(TAG, "  Max Transactions: %u", this->max_transactions_);
+  }
+  ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
+}
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_TCP
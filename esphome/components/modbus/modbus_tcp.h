@@ -0,0 +1,89 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MODBUS_TCP
+
+#include "modbus.h"
+#include "esphome/components/socket/socket.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace modbus {
+
+enum ModbusTCPTransport : uint8_t {
+  /// Frames with an MBAP header and no CRC, responses are matched to requests by the transaction id.
+  MODBUS_TRANSPORT_TCP,
+  /// RTU frames with CRC sent over a TCP connection, as used by most serial gateways in transparent mode.
+  MODBUS_TRANSPORT_RTU_OVER_TCP,
+};
+
+/** Modbus client for a TCP device or gateway.
+ *
+ * With the Modbus TCP transport up to max_transactions requests to different devices are in flight at the same time,
+ * one per device, so a gateway can serve its serial buses in parallel and the network round trip is paid once for all
+ * of them. RTU frames carry nothing to match a response to its request, so RTU over TCP keeps one request in flight.
+ *
+ * The connection is opened from loop() once the network is up and reopened after errors.
+ */
+class ModbusTCP : public Modbus {
+ public:
+  // there is no UART or flow control pin to set up, the connection is opened from loop()
+  void setup() override {}
+  void loop() override;
+  void dump_config() override;
+
+  void set_host(const std::string &host) { this->host_ = host; }
+  void set_port(uint16_t port) { this->port_ = port; }
+  void set_transport(ModbusTCPTransport transport) { this->transport_ = transport; }
+  void set_max_transactions(uint8_t max_transactions) { this->max_transactions_ = max_transactions; }
+
+  bool is_waiting_for_response(uint8_t address) const override;
+
+ protected:
+  /// Length of the MBAP header up to and including the length field.
+  static const size_t MBAP_HEADER_SIZE = 6;
+
+  struct Transaction {
+    uint16_t id;
+    uint8_t address;
+    /// When the request was sent or, for the oldest request, when the one before it was finished.
+    uint32_t since;
+  };
+
+  void write_frame_(std::vector<uint8_t> &frame) override;
+  bool can_send_() const override;
+
+  void connect_();
+  /// Check whether the connection attempt finished, return true once connected.
+  bool check_connected_();
+  /// Read everything available from the socket into rx_buffer_, return false if the connection was closed.
+  bool read_();
+  void flush_();
+  void parse_mbap_buffer_();
+  /// Handle the unit id and PDU of a Modbus TCP frame.
+  void handle_mbap_frame_(uint16_t transaction_id, const uint8_t *raw, uint16_t len);
+  void finish_transaction_(size_t index);
+  void close_();
+
+  std::string host_;
+  uint16_t port_{502};
+  ModbusTCPTransport transport_{MODBUS_TRANSPORT_TCP};
+  uint8_t max_transactions_{4};
+
+  std::unique_ptr<socket::Socket> socket_;
+  bool connected_{false};
+  uint32_t last_connect_attempt_{0};
+  std::vector<uint8_t> tx_buffer_;
+  /// Requests sent with the Modbus TCP transport that didn't get their response yet, oldest first.
+  std::vector<Transaction> transactions_;
+  uint16_t last_transaction_id_{0};
+};
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_TCP
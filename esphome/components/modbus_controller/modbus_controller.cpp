@@ -11,12 +11,13 @@ void ModbusController::setup() { this->create_register_ranges_(); }
 
 /*
  To work with the existing modbus class and avoid polling for responses a command queue is used.
- send_next_command will submit the command at the top of the queue and set the corresponding callback
- to handle the response from the device.
+ The modbus bus calls send_next_command when it is this device's turn, which will submit the command at the top of
+ the queue and set the corresponding callback to handle the response from the device.
  Once the response has been processed it is removed from the queue and the next command is sent
 */
 bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
+  bool sent = false;
 
   if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty()) {
     auto &command = this->command_queue_.front();
@@ -43,6 +44,7 @@ bool ModbusController::send_next_command_() {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
       command->send();
+      sent = true;
 
       this->last_command_timestamp_ = millis();
 
@@ -54,7 +56,14 @@ bool ModbusController::send_next_command_() {
       }
     }
   }
-  return (!this->command_queue_.empty());
+  return sent;
+}
+
+bool ModbusController::get_pending_command_deadline(uint32_t &deadline) {
+  if (this->command_queue_.empty())
+    return false;
+  deadline = this->command_queue_.front()->deadline;
+  return true;
 }
 
 // Queue incoming response
@@ -176,7 +185,10 @@ void ModbusController::on_register_data(ModbusRegisterType register_type, uint16
   }
 }
 
-void ModbusController::queue_command(const ModbusCommandItem &command) {
+// commands queued by the user are due right away
+void ModbusController::queue_command(const ModbusCommandItem &command) { this->queue_command_(command, millis()); }
+
+void ModbusController::queue_command_(const ModbusCommandItem &command, uint32_t deadline) {
   if (!this->allow_duplicate_commands_) {
     // check if this command is already qeued.
     // not very effective but the queue is never really large
@@ -192,12 +204,15 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
     }
   }
   this->command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  this->command_queue_.back()->deadline = deadline;
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
   ESP_LOGV(TAG, "Range : %X Size: %x (%d) skip: %d", r.start_address, r.register_count, (int) r.register_type,
            r.skip_updates_counter);
   if (r.skip_updates_counter == 0) {
+    // reads are due before the next update queues them again
+    const uint32_t deadline = millis() + this->get_update_interval();
     // if a custom command is used the user supplied custom_data is only available in the SensorItem.
     if (r.register_type == ModbusRegisterType::CUSTOM) {
       auto sensors = this->find_sensors_(r.register_type, r.start_address);
@@ -211,10 +226,11 @@ void ModbusController::update_range_(RegisterRange &r) {
         command_item.register_address = (*sensor)->start_address;
         command_item.register_count = (*sensor)->register_count;
         command_item.function_code = ModbusFunctionCode::CUSTOM;
-        queue_command(command_item);
+        this->queue_command_(command_item, deadline);
       }
     } else {
-      queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
+      this->queue_command_(
+          ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count), deadline);
     }
     r.skip_updates_counter = r.skip_updates;  // reset counter to config value
   } else {
@@ -377,11 +393,8 @@ void ModbusController::loop() {
     if (message != nullptr)
       this->process_modbus_data_(message.get());
     this->incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    this->send_next_command_();
   }
+  // pending commands are sent by the modbus bus, interleaved with the other devices
 }
 
 void ModbusController::on_write_register_response(ModbusRegisterType register_type, uint16_t start_address,
@@ -320,6 +320,8 @@ class ModbusCommandItem {
   std::function<void(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data)>
       on_data_func;
   std::vector<uint8_t> payload = {};
+  /// millis() by which the command should be sent, orders the commands of all devices on the bus
+  uint32_t deadline{0};
   bool send();
   /// Check if the command should be retried based on the max_retries parameter
   bool should_retry(uint8_t max_retries) { return this->send_count_ <= max_retries; };
@@ -446,6 +448,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
   /// called when a modbus request (function code 3 or 4) was parsed without errors
   void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers) final;
+  /// called by the modbus bus to find the device that sends next
+  bool get_pending_command_deadline(uint32_t &deadline) override;
+  /// called by the modbus bus when this device may send its next command
+  bool send_pending_command() override { return this->send_next_command_(); }
   /// default delegate called by process_modbus_data when a response has retrieved from the incoming queue
   void on_register_data(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data);
   /// default delegate called by process_modbus_data when a response for a write response has retrieved from the
@@ -484,9 +490,11 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
   void update_range_(RegisterRange &r);
+  /// queues a modbus command that should be sent by the deadline in millis()
+  void queue_command_(const ModbusCommandItem &command, uint32_t deadline);
   /// parse incoming modbus data
   void process_modbus_data_(const ModbusCommandItem *response);
-  /// send the next modbus command from the send queue
+  /// send the next modbus command from the send queue, return whether a command was sent
   bool send_next_command_();
   /// dump the parsed sensormap for diagnostics
   void dump_sensors_();
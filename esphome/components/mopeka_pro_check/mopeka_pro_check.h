@@ -28,10 +28,8 @@ enum SensorType {
 // measurement may be inaccurate.
 enum SensorReadQuality { QUALITY_HIGH = 0x3, QUALITY_MED = 0x2, QUALITY_LOW = 0x1, QUALITY_ZERO = 0x0 };
 
-class MopekaProCheck : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class MopekaProCheck : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; };
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -47,7 +45,6 @@ class MopekaProCheck : public Component, public esp32_ble_tracker::ESPBTDeviceLi
   void set_tank_empty(float empty) { empty_mm_ = empty; };
 
  protected:
-  uint64_t address_;
   sensor::Sensor *level_{nullptr};
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *distance_{nullptr};
@@ -42,10 +42,8 @@ struct mopeka_std_package {  // NOLINT(readability-identifier-naming,altera-stru
   mopeka_std_values val[4];
 } __attribute__((packed));
 
-class MopekaStdCheck : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class MopekaStdCheck : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; };
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -59,7 +57,6 @@ class MopekaStdCheck : public Component, public esp32_ble_tracker::ESPBTDeviceLi
   void set_tank_empty(float empty) { this->empty_mm_ = empty; };
 
  protected:
-  uint64_t address_;
   sensor::Sensor *level_{nullptr};
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *distance_{nullptr};
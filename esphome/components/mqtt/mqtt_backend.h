@@ -62,6 +62,9 @@ class MQTTBackend {
                    message.retain);
   }
 
+  /// Bytes of outgoing messages that are queued but not sent yet, 0 if the backend can't tell.
+  virtual size_t get_outbox_size() const { return 0; }
+
   // called from MQTTClient::loop()
   virtual void loop() {}
 };
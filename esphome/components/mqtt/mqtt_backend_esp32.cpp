@@ -4,6 +4,7 @@
 #ifdef USE_ESP32
 
 #include <string>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
@@ -185,6 +186,10 @@ void MQTTBackendESP32::mqtt_event_handler(void *handler_args, esp_event_base_t b
   if (instance) {
     auto event = *static_cast<esp_mqtt_event_t *>(event_data);
     instance->mqtt_events_.emplace(event);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    // Messages are handled from loop(), don't let them wait for the rest of the loop interval
+    App.wake_loop_threadsafe();
+#endif
   }
 }
 
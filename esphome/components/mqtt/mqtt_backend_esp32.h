@@ -7,6 +7,7 @@
 #include <string>
 #include <queue>
 #include <mqtt_client.h>
+#include <esp_idf_version.h>
 #include "esphome/components/network/ip_address.h"
 #include "esphome/core/helpers.h"
 
@@ -121,6 +122,11 @@ class MQTTBackendESP32 final : public MQTTBackend {
 #endif
   }
   using MQTTBackend::publish;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  size_t get_outbox_size() const final {
+    return is_initalized_ ? static_cast<size_t>(esp_mqtt_client_get_outbox_size(handler_.get())) : 0;
+  }
+#endif
 
   void loop() final;
 
@@ -0,0 +1,371 @@
+#include "mqtt_backend_host.h"
+
+#ifdef USE_MQTT
+#ifdef USE_HOST
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace mqtt {
+
+static const char *const TAG = "mqtt.host";
+
+// MQTT 3.1.1 control packet types, in the upper nibble of the first byte
+static const uint8_t MQTT_CONNECT = 0x10;
+static const uint8_t MQTT_CONNACK = 0x20;
+static const uint8_t MQTT_PUBLISH = 0x30;
+static const uint8_t MQTT_PUBACK = 0x40;
+static const uint8_t MQTT_SUBSCRIBE = 0x82;  // with the reserved flags set
+static const uint8_t MQTT_SUBACK = 0x90;
+static const uint8_t MQTT_UNSUBSCRIBE = 0xA2;
+static const uint8_t MQTT_UNSUBACK = 0xB0;
+static const uint8_t MQTT_PINGREQ = 0xC0;
+static const uint8_t MQTT_PINGRESP = 0xD0;
+static const uint8_t MQTT_DISCONNECT = 0xE0;
+
+static void append_uint16(std::vector<uint8_t> &buffer, uint16_t value) {
+  buffer.push_back(value >> 8);
+  buffer.push_back(value);
+}
+
+static void append_string(std::vector<uint8_t> &buffer, const char *data, size_t length) {
+  append_uint16(buffer, length);
+  buffer.insert(buffer.end(), data, data + length);
+}
+
+static void append_string(std::vector<uint8_t> &buffer, const std::string &value) {
+  append_string(buffer, value.data(), value.size());
+}
+
+static uint16_t read_uint16(const uint8_t *data) { return (uint16_t(data[0]) << 8) | data[1]; }
+
+void MQTTBackendHost::connect() {
+  if (this->state_ != STATE_DISCONNECTED)
+    return;
+
+  struct addrinfo hints {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result;
+  int err = getaddrinfo(this->host_.c_str(), to_string(this->port_).c_str(), &hints, &result);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Couldn't resolve '%s': %s", this->host_.c_str(), gai_strerror(err));
+    this->on_disconnect_.call(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+    return;
+  }
+  this->fd_ = ::socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+  if (this->fd_ >= 0) {
+    int enable = 1;
+    setsockopt(this->fd_, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    fcntl(this->fd_, F_SETFL, fcntl(this->fd_, F_GETFL, 0) | O_NONBLOCK);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    this->loop_monitored_ = App.register_socket_fd(this->fd_);
+#endif
+    if (::connect(this->fd_, result->ai_addr, result->ai_addrlen) == 0 || errno == EINPROGRESS) {
+      this->state_ = STATE_TCP_CONNECTING;
+    } else {
+      ESP_LOGW(TAG, "Couldn't connect to %s:%u: %s", this->host_.c_str(), this->port_, strerror(errno));
+    }
+  }
+  freeaddrinfo(result);
+  if (this->state_ == STATE_DISCONNECTED)
+    this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+}
+
+void MQTTBackendHost::disconnect() {
+  if (this->state_ == STATE_DISCONNECTED)
+    return;
+  if (this->state_ == STATE_CONNECTED) {
+    this->send_packet_(MQTT_DISCONNECT, {});
+  }
+  this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+}
+
+bool MQTTBackendHost::subscribe(const char *topic, uint8_t qos) {
+  if (this->state_ != STATE_CONNECTED)
+    return false;
+  std::vector<uint8_t> body;
+  append_uint16(body, this->next_packet_id_());
+  append_string(body, topic, strlen(topic));
+  body.push_back(std::min<uint8_t>(qos, 1));
+  this->send_packet_(MQTT_SUBSCRIBE, body);
+  return this->fd_ >= 0;
+}
+
+bool MQTTBackendHost::unsubscribe(const char *topic) {
+  if (this->state_ != STATE_CONNECTED)
+    return false;
+  std::vector<uint8_t> body;
+  append_uint16(body, this->next_packet_id_());
+  append_string(body, topic, strlen(topic));
+  this->send_packet_(MQTT_UNSUBSCRIBE, body);
+  return this->fd_ >= 0;
+}
+
+bool MQTTBackendHost::publish(const char *topic, const char *payload, size_t length, uint8_t qos, bool retain) {
+  if (this->state_ != STATE_CONNECTED)
+    return false;
+  qos = std::min<uint8_t>(qos, 1);
+  size_t topic_length = strlen(topic);
+  std::vector<uint8_t> body;
+  body.reserve(2 + topic_length + 2 + length);
+  append_string(body, topic, topic_length);
+  if (qos > 0)
+    append_uint16(body, this->next_packet_id_());
+  body.insert(body.end(), payload, payload + length);
+  this->send_packet_(MQTT_PUBLISH | (qos << 1) | (retain ? 1 : 0), body);
+  return this->fd_ >= 0;
+}
+
+void MQTTBackendHost::loop() {
+  if (this->state_ == STATE_DISCONNECTED)
+    return;
+
+  if (this->state_ == STATE_TCP_CONNECTING) {
+    struct pollfd pfd {
+      .fd = this->fd_, .events = POLLOUT, .revents = 0,
+    };
+    if (poll(&pfd, 1, 0) <= 0)
+      return;
+    int error = 0;
+    socklen_t len = sizeof(error);
+    getsockopt(this->fd_, SOL_SOCKET, SO_ERROR, &error, &len);
+    if (error != 0) {
+      ESP_LOGW(TAG, "Couldn't connect to %s:%u: %s", this->host_.c_str(), this->port_, strerror(error));
+      this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+      return;
+    }
+    this->send_connect_();
+  }
+
+  this->flush_();
+  this->read_();
+  if (this->state_ == STATE_DISCONNECTED)
+    return;
+
+  const uint32_t now = millis();
+  if (this->keep_alive_ != 0) {
+    if (now - this->last_received_ > this->keep_alive_ * 1500u) {
+      ESP_LOGW(TAG, "Broker didn't respond within the keep alive interval");
+      this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+      return;
+    }
+    if (this->state_ == STATE_CONNECTED && now - this->last_sent_ > this->keep_alive_ * 1000u)
+      this->send_packet_(MQTT_PINGREQ, {});
+  }
+}
+
+void MQTTBackendHost::send_connect_() {
+  std::vector<uint8_t> body;
+  append_string(body, "MQTT", 4);
+  body.push_back(4);  // protocol level 3.1.1
+  uint8_t flags = this->clean_session_ ? 0x02 : 0x00;
+  if (!this->lwt_topic_.empty())
+    flags |= 0x04 | (std::min<uint8_t>(this->lwt_qos_, 1) << 3) | (this->lwt_retain_ ? 0x20 : 0x00);
+  if (!this->username_.empty()) {
+    flags |= 0x80;
+    if (!this->password_.empty())
+      flags |= 0x40;
+  }
+  body.push_back(flags);
+  append_uint16(body, this->keep_alive_);
+  append_string(body, this->client_id_);
+  if (!this->lwt_topic_.empty()) {
+    append_string(body, this->lwt_topic_);
+    append_string(body, this->lwt_message_);
+  }
+  if (flags & 0x80)
+    append_string(body, this->username_);
+  if (flags & 0x40)
+    append_string(body, this->password_);
+  this->state_ = STATE_WAITING_FOR_CONNACK;
+  this->last_received_ = millis();
+  this->send_packet_(MQTT_CONNECT, body);
+}
+
+void MQTTBackendHost::send_packet_(uint8_t header, const std::vector<uint8_t> &body) {
+  if (this->fd_ < 0)
+    return;
+  this->tx_buffer_.push_back(header);
+  size_t remaining = body.size();
+  do {
+    uint8_t byte = remaining & 0x7F;
+    remaining >>= 7;
+    this->tx_buffer_.push_back(remaining != 0 ? byte | 0x80 : byte);
+  } while (remaining != 0);
+  this->tx_buffer_.insert(this->tx_buffer_.end(), body.begin(), body.end());
+  this->last_sent_ = millis();
+  this->flush_();
+}
+
+void MQTTBackendHost::flush_() {
+  if (this->fd_ < 0 || this->tx_offset_ == this->tx_buffer_.size() || this->state_ == STATE_TCP_CONNECTING)
+    return;
+  ssize_t sent = send(this->fd_, this->tx_buffer_.data() + this->tx_offset_, this->tx_buffer_.size() - this->tx_offset_,
+                      MSG_NOSIGNAL);
+  if (sent < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK)
+      return;
+    ESP_LOGW(TAG, "Send failed: %s", strerror(errno));
+    this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+    return;
+  }
+  this->tx_offset_ += sent;
+  if (this->tx_offset_ == this->tx_buffer_.size()) {
+    this->tx_buffer_.clear();
+    this->tx_offset_ = 0;
+  } else if (this->tx_offset_ >= this->tx_buffer_.size() / 2) {
+    // drop the sent bytes once they are the larger part, so each byte is moved at most once on average
+    this->tx_buffer_.erase(this->tx_buffer_.begin(), this->tx_buffer_.begin() + this->tx_offset_);
+    this->tx_offset_ = 0;
+  }
+}
+
+void MQTTBackendHost::read_() {
+  uint8_t buffer[1460];
+  while (this->fd_ >= 0) {
+    ssize_t received = recv(this->fd_, buffer, sizeof(buffer), 0);
+    if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      break;
+    if (received <= 0) {
+      ESP_LOGW(TAG, "Connection closed by broker");
+      this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+      return;
+    }
+    this->last_received_ = millis();
+    this->rx_buffer_.insert(this->rx_buffer_.end(), buffer, buffer + received);
+  }
+
+  // dispatch all complete packets
+  size_t offset = 0;
+  while (this->fd_ >= 0) {
+    const uint8_t *data = this->rx_buffer_.data() + offset;
+    size_t available = this->rx_buffer_.size() - offset;
+    size_t length = 0;
+    size_t header_length = 1;
+    bool complete = false;
+    for (int shift = 0; header_length < available && shift <= 21; shift += 7) {
+      uint8_t byte = data[header_length++];
+      length |= size_t(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        complete = true;
+        break;
+      }
+    }
+    if (!complete) {
+      // the remaining length has at most four bytes, the fourth one must not have the continuation bit set
+      if (header_length > 4) {
+        ESP_LOGW(TAG, "Received packet with a malformed remaining length");
+        this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+        return;
+      }
+      break;
+    }
+    if (length > MQTT_MAX_PACKET_SIZE) {
+      ESP_LOGW(TAG, "Received packet of %zu bytes is too large", length);
+      this->close_(MQTTClientDisconnectReason::TCP_DISCONNECTED);
+      return;
+    }
+    if (available < header_length + length)
+      break;
+    offset += header_length + length;
+    this->handle_packet_(data[0], data + header_length, length);
+  }
+  if (this->fd_ >= 0)
+    this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + offset);
+}
+
+void MQTTBackendHost::handle_packet_(uint8_t header, const uint8_t *data, size_t length) {
+  switch (header & 0xF0) {
+    case MQTT_CONNACK:
+      if (length < 2)
+        break;
+      if (data[1] != 0) {
+        ESP_LOGW(TAG, "Broker refused the connection: %u", data[1]);
+        this->close_(static_cast<MQTTClientDisconnectReason>(data[1]));
+        return;
+      }
+      this->state_ = STATE_CONNECTED;
+      this->on_connect_.call((data[0] & 0x01) != 0);
+      break;
+    case MQTT_PUBLISH: {
+      if (length < 2)
+        break;
+      uint8_t qos = (header >> 1) & 0x03;
+      size_t topic_length = read_uint16(data);
+      size_t payload_offset = 2 + topic_length + (qos > 0 ? 2 : 0);
+      if (payload_offset > length)
+        break;
+      std::string topic(reinterpret_cast<const char *>(data + 2), topic_length);
+      size_t payload_length = length - payload_offset;
+      uint16_t packet_id = qos > 0 ? read_uint16(data + 2 + topic_length) : 0;
+      this->on_message_.call(topic.c_str(), reinterpret_cast<const char *>(data + payload_offset), payload_length, 0,
+                             payload_length);
+      if (qos > 0) {
+        std::vector<uint8_t> body;
+        append_uint16(body, packet_id);
+        this->send_packet_(MQTT_PUBACK, body);
+      }
+      break;
+    }
+    case MQTT_PUBACK:
+      if (length >= 2)
+        this->on_publish_.call(read_uint16(data));
+      break;
+    case MQTT_SUBACK:
+      if (length >= 3)
+        this->on_subscribe_.call(read_uint16(data), data[2]);
+      break;
+    case MQTT_UNSUBACK:
+      if (length >= 2)
+        this->on_unsubscribe_.call(read_uint16(data));
+      break;
+    case MQTT_PINGRESP:
+      break;
+    default:
+      ESP_LOGV(TAG, "Ignoring packet 0x%02X", header);
+      break;
+  }
+}
+
+void MQTTBackendHost::close_(MQTTClientDisconnectReason reason) {
+  if (this->fd_ >= 0) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_)
+      App.unregister_socket_fd(this->fd_);
+#endif
+    this->loop_monitored_ = false;
+    ::close(this->fd_);
+    this->fd_ = -1;
+  }
+  this->rx_buffer_.clear();
+  this->tx_buffer_.clear();
+  this->tx_offset_ = 0;
+  this->state_ = STATE_DISCONNECTED;
+  this->on_disconnect_.call(reason);
+}
+
+uint16_t MQTTBackendHost::next_packet_id_() {
+  // packet ids must not be zero
+  if (++this->last_packet_id_ == 0)
+    this->last_packet_id_ = 1;
+  return this->last_packet_id_;
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif
+#endif
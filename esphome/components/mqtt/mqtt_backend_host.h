@@ -0,0 +1,134 @@
+#pragma once
+
+#include "mqtt_backend.h"
+#ifdef USE_MQTT
+#ifdef USE_HOST
+
+#include <string>
+#include <vector>
+#include "esphome/components/network/ip_address.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace mqtt {
+
+/** MQTT 3.1.1 client over a non-blocking POSIX socket, for the host platform.
+ *
+ * Everything happens in loop(): the connection is established, outgoing packets that didn't fit into the socket are
+ * sent and received packets are dispatched to the callbacks. Only QoS 0 and 1 are implemented, subscriptions and
+ * publishes with QoS 2 are downgraded to QoS 1. Unacknowledged QoS 1 publishes are not resent after a reconnect.
+ */
+class MQTTBackendHost final : public MQTTBackend {
+ public:
+  /// Received packets larger than this close the connection.
+  static const size_t MQTT_MAX_PACKET_SIZE = 1024 * 1024;
+
+  void set_keep_alive(uint16_t keep_alive) final { this->keep_alive_ = keep_alive; }
+  void set_client_id(const char *client_id) final { this->client_id_ = client_id; }
+  void set_clean_session(bool clean_session) final { this->clean_session_ = clean_session; }
+
+  void set_credentials(const char *username, const char *password) final {
+    this->username_ = username != nullptr ? username : "";
+    this->password_ = password != nullptr ? password : "";
+  }
+  void set_will(const char *topic, uint8_t qos, bool retain, const char *payload) final {
+    if (topic)
+      this->lwt_topic_ = topic;
+    this->lwt_qos_ = qos;
+    if (payload)
+      this->lwt_message_ = payload;
+    this->lwt_retain_ = retain;
+  }
+  void set_server(network::IPAddress ip, uint16_t port) final {
+    this->host_ = ip.str();
+    this->port_ = port;
+  }
+  void set_server(const char *host, uint16_t port) final {
+    this->host_ = host;
+    this->port_ = port;
+  }
+  void set_on_connect(std::function<on_connect_callback_t> &&callback) final {
+    this->on_connect_.add(std::move(callback));
+  }
+  void set_on_disconnect(std::function<on_disconnect_callback_t> &&callback) final {
+    this->on_disconnect_.add(std::move(callback));
+  }
+  void set_on_subscribe(std::function<on_subscribe_callback_t> &&callback) final {
+    this->on_subscribe_.add(std::move(callback));
+  }
+  void set_on_unsubscribe(std::function<on_unsubscribe_callback_t> &&callback) final {
+    this->on_unsubscribe_.add(std::move(callback));
+  }
+  void set_on_message(std::function<on_message_callback_t> &&callback) final {
+    this->on_message_.add(std::move(callback));
+  }
+  void set_on_publish(std::function<on_publish_user_callback_t> &&callback) final {
+    this->on_publish_.add(std::move(callback));
+  }
+  bool connected() const final { return this->state_ == STATE_CONNECTED; }
+
+  void connect() final;
+  void disconnect() final;
+  bool subscribe(const char *topic, uint8_t qos) final;
+  bool unsubscribe(const char *topic) final;
+  bool publish(const char *topic, const char *payload, size_t length, uint8_t qos, bool retain) final;
+  using MQTTBackend::publish;
+  size_t get_outbox_size() const final { return this->tx_buffer_.size() - this->tx_offset_; }
+
+  void loop() final;
+
+ protected:
+  enum State : uint8_t {
+    STATE_DISCONNECTED,
+    STATE_TCP_CONNECTING,
+    STATE_WAITING_FOR_CONNACK,
+    STATE_CONNECTED,
+  };
+
+  void send_connect_();
+  /// Queue a packet of the given type, with the remaining length encoded from body, and try to send it.
+  void send_packet_(uint8_t header, const std::vector<uint8_t> &body);
+  void flush_();
+  void read_();
+  void handle_packet_(uint8_t header, const uint8_t *data, size_t length);
+  void close_(MQTTClientDisconnectReason reason);
+  uint16_t next_packet_id_();
+
+  int fd_{-1};
+  /// Whether fd_ is registered with the application, so the main loop wakes up when data arrives.
+  bool loop_monitored_{false};
+  State state_{STATE_DISCONNECTED};
+  std::vector<uint8_t> rx_buffer_;
+  std::vector<uint8_t> tx_buffer_;
+  /// Bytes at the start of tx_buffer_ that were already sent.
+  size_t tx_offset_{0};
+  uint16_t last_packet_id_{0};
+  uint32_t last_sent_{0};
+  uint32_t last_received_{0};
+
+  std::string host_;
+  uint16_t port_{};
+  std::string username_;
+  std::string password_;
+  std::string lwt_topic_;
+  std::string lwt_message_;
+  uint8_t lwt_qos_{};
+  bool lwt_retain_{};
+  std::string client_id_;
+  uint16_t keep_alive_{15};
+  bool clean_session_{true};
+
+  // callbacks
+  CallbackManager<on_connect_callback_t> on_connect_;
+  CallbackManager<on_disconnect_callback_t> on_disconnect_;
+  CallbackManager<on_subscribe_callback_t> on_subscribe_;
+  CallbackManager<on_unsubscribe_callback_t> on_unsubscribe_;
+  CallbackManager<on_message_callback_t> on_message_;
+  CallbackManager<on_publish_user_callback_t> on_publish_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif
+#endif
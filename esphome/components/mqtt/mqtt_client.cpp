@@ -11,8 +11,13 @@
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
 #endif
+#ifdef USE_HOST
+#include <netdb.h>
+#include <netinet/in.h>
+#else
 #include "lwip/dns.h"
 #include "lwip/err.h"
+#endif
 #include "mqtt_component.h"
 
 #ifdef USE_API
@@ -26,6 +31,16 @@ namespace esphome {
 namespace mqtt {
 
 static const char *const TAG = "mqtt";
+/// Components whose discovery and state is sent per loop after connecting.
+static const uint8_t MQTT_DISCOVERY_PER_LOOP = 4;
+/// Bytes in the backend outbox above which sending discovery waits for it to drain.
+static const size_t MQTT_DISCOVERY_MAX_OUTBOX = 4096;
+/// Time without a retained discovery config arriving after which the broker is assumed to have sent all of them.
+static const uint32_t MQTT_RETAINED_DISCOVERY_WAIT = 500;
+
+static uint32_t discovery_config_hash(const std::string &topic, const std::string &config) {
+  return fnv1_hash(config) * 31 + fnv1_hash(topic);
+}
 
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
@@ -120,6 +135,9 @@ void MQTTClientComponent::send_device_info_() {
 #ifdef USE_LIBRETINY
         root["platform"] = lt_cpu_get_model_name();
 #endif
+#ifdef USE_HOST
+        root["platform"] = "Host";
+#endif
 
         root["board"] = ESPHOME_BOARD;
 #if defined(USE_WIFI)
@@ -179,6 +197,22 @@ void MQTTClientComponent::start_dnslookup_() {
   this->status_set_warning();
   this->dns_resolve_error_ = false;
   this->dns_resolved_ = false;
+#ifdef USE_HOST
+  // the system resolver blocks, so the address is known right away
+  struct addrinfo hints {};
+  hints.ai_family = AF_INET;
+  struct addrinfo *result;
+  int err = getaddrinfo(this->credentials_.address.c_str(), nullptr, &hints, &result);
+  if (err == 0) {
+    this->dns_resolved_ = true;
+    this->ip_ = network::IPAddress(&reinterpret_cast<struct sockaddr_in *>(result->ai_addr)->sin_addr);
+    freeaddrinfo(result);
+    this->start_connect_();
+    return;
+  }
+  ESP_LOGW(TAG, "Error resolving MQTT broker IP address: %s", gai_strerror(err));
+  this->dns_resolve_error_ = true;
+#else
   ip_addr_t addr;
 #if USE_NETWORK_IPV6
   err_t err = dns_gethostbyname_addrtype(this->credentials_.address.c_str(), &addr,
@@ -207,6 +241,7 @@ void MQTTClientComponent::start_dnslookup_() {
       break;
     }
   }
+#endif
 
   this->state_ = MQTT_CLIENT_RESOLVING_ADDRESS;
   this->connect_begin_ = millis();
@@ -229,6 +264,7 @@ void MQTTClientComponent::check_dnslookup_() {
   ESP_LOGD(TAG, "Resolved broker IP address to %s", this->ip_.str().c_str());
   this->start_connect_();
 }
+#ifndef USE_HOST
 #if defined(USE_ESP8266) && LWIP_VERSION_MAJOR == 1
 void MQTTClientComponent::dns_found_callback(const char *name, ip_addr_t *ipaddr, void *callback_arg) {
 #else
@@ -242,6 +278,7 @@ void MQTTClientComponent::dns_found_callback(const char *name, const ip_addr_t *
     a_this->dns_resolved_ = true;
   }
 }
+#endif
 
 void MQTTClientComponent::start_connect_() {
   if (!network::is_connected())
@@ -295,8 +332,56 @@ void MQTTClientComponent::check_connected() {
   this->resubscribe_subscriptions_();
   this->send_device_info_();
 
-  for (MQTTComponent *component : this->children_)
-    component->schedule_resend_state();
+  // Walk all components again, starting with the one the walk was at when the connection was lost, so the components
+  // that didn't get their discovery out yet go first. The broker sends the retained discovery configs it still has
+  // for this node when subscribing to them, the components whose config is among them don't publish it again.
+  this->discovery_remaining_ = this->children_.size();
+  this->retained_discovery_.clear();
+  this->last_retained_discovery_ = millis();
+  this->discovery_waiting_for_retained_ = false;
+  if (this->is_discovery_enabled() && this->discovery_info_.retain && !this->discovery_info_.clean) {
+    if (!this->retained_discovery_subscribed_) {
+      this->subscribe(this->get_discovery_config_filter_(),
+                      [this](const std::string &topic, const std::string &payload) {
+                        this->retained_discovery_.insert(discovery_config_hash(topic, payload));
+                        this->last_retained_discovery_ = millis();
+                      });
+      this->retained_discovery_subscribed_ = true;
+    }
+    this->discovery_waiting_for_retained_ = true;
+  }
+}
+
+std::string MQTTClientComponent::get_discovery_config_filter_() const {
+  return this->discovery_info_.prefix + "/+/" + str_sanitize(App.get_name()) + "/+/config";
+}
+
+bool MQTTClientComponent::is_discovery_retained(const std::string &topic, const std::string &config) const {
+  return this->retained_discovery_.count(discovery_config_hash(topic, config)) != 0;
+}
+
+void MQTTClientComponent::send_pending_discovery_() {
+  if (this->discovery_waiting_for_retained_) {
+    if (millis() - this->last_retained_discovery_ < MQTT_RETAINED_DISCOVERY_WAIT)
+      return;
+    ESP_LOGV(TAG, "Broker has %zu retained discovery configs", this->retained_discovery_.size());
+    this->discovery_waiting_for_retained_ = false;
+    // MQTT 3.1.1 has no way to leave out our own messages, stay subscribed and the broker echoes every config sent
+    this->unsubscribe(this->get_discovery_config_filter_());
+    this->retained_discovery_subscribed_ = false;
+  }
+  for (uint8_t sent = 0; sent < MQTT_DISCOVERY_PER_LOOP && this->discovery_remaining_ != 0; sent++) {
+    // Leave the outbox to the messages already queued until it drained, publishing into a full one fails anyway
+    if (this->mqtt_backend_.get_outbox_size() > MQTT_DISCOVERY_MAX_OUTBOX)
+      return;
+    if (this->discovery_index_ >= this->children_.size())
+      this->discovery_index_ = 0;
+    if (!this->children_[this->discovery_index_]->send_discovery_and_state())
+      return;  // retry in the next loop
+    this->discovery_index_++;
+    if (--this->discovery_remaining_ == 0)
+      this->retained_discovery_.clear();
+  }
 }
 
 void MQTTClientComponent::loop() {
@@ -369,6 +454,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->send_pending_discovery_();
       }
       break;
   }
@@ -424,6 +510,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
       .resubscribe_timeout = 0,
   };
   this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.insert(topic, this->subscriptions_.size());
   this->subscriptions_.push_back(subscription);
 }
 
@@ -442,6 +529,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
       .resubscribe_timeout = 0,
   };
   this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.insert(topic, this->subscriptions_.size());
   this->subscriptions_.push_back(subscription);
 }
 
@@ -464,6 +552,11 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
       ++it;
     }
   }
+  // the trie refers to subscriptions by index
+  this->subscriptions_generation_++;
+  this->subscription_trie_.clear();
+  for (size_t i = 0; i < this->subscriptions_.size(); i++)
+    this->subscription_trie_.insert(this->subscriptions_[i].topic, i);
 }
 
 // Publish
@@ -525,78 +618,32 @@ void MQTTClientComponent::disable() {
   this->on_shutdown();
 }
 
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
-}
-
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
 #ifdef USE_ESP8266
   // on ESP8266, this is called in lwIP/AsyncTCP task; some components do not like running
-  // from a different task.
-  this->defer([this, topic, payload]() {
-#endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
-    }
-#ifdef USE_ESP8266
-  });
+  // from a different task. Only copy the message if a subscription is interested in it.
+  std::vector<uint16_t> matches;
+  this->subscription_trie_.match(topic, matches);
+  if (matches.empty())
+    return;
+  this->defer([this, topic, payload]() { this->dispatch_message_(topic, payload); });
+#else
+  this->dispatch_message_(topic, payload);
 #endif
 }
 
+void MQTTClientComponent::dispatch_message_(const std::string &topic, const std::string &payload) {
+  this->matches_.clear();
+  this->subscription_trie_.match(topic, this->matches_);
+  const uint32_t generation = this->subscriptions_generation_;
+  for (uint16_t index : this->matches_) {
+    // a callback that unsubscribed renumbered the subscriptions, the remaining indices are stale
+    if (this->subscriptions_generation_ != generation)
+      break;
+    this->subscriptions_[index].callback(topic, payload);
+  }
+}
+
 // Setters
 void MQTTClientComponent::disable_log_message() { this->log_message_.topic = ""; }
 bool MQTTClientComponent::is_log_message_enabled() const { return !this->log_message_.topic.empty(); }
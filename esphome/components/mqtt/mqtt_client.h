@@ -8,16 +8,23 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/log.h"
 #include "esphome/components/json/json_util.h"
+#include "esphome/components/json/json_writer.h"
 #include "esphome/components/network/ip_address.h"
+#include "mqtt_topic_trie.h"
 #if defined(USE_ESP32)
 #include "mqtt_backend_esp32.h"
 #elif defined(USE_ESP8266)
 #include "mqtt_backend_esp8266.h"
 #elif defined(USE_LIBRETINY)
 #include "mqtt_backend_libretiny.h"
+#elif defined(USE_HOST)
+#include "mqtt_backend_host.h"
 #endif
+#ifndef USE_HOST
 #include "lwip/ip_addr.h"
+#endif
 
+#include <unordered_set>
 #include <vector>
 
 namespace esphome {
@@ -133,6 +140,8 @@ class MQTTClientComponent : public Component {
   void disable_discovery();
   bool is_discovery_enabled() const;
   bool is_discovery_ip_enabled() const;
+  /// Whether the broker sent this discovery config as retained after connecting, so it doesn't need to be published.
+  bool is_discovery_retained(const std::string &topic, const std::string &config) const;
 
 #if ASYNC_TCP_SSL_ENABLED
   /** Add a SSL fingerprint to use for TCP SSL connections to the MQTT broker.
@@ -229,6 +238,12 @@ class MQTTClientComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos = 0, bool retain = false);
 
+  /// Get the cleared writer that is shared by all state messages, which are published from the main loop only.
+  json::JsonWriter &get_json_writer() {
+    this->json_writer_.clear();
+    return this->json_writer_;
+  }
+
   /// Setup the MQTT client, registering a bunch of callbacks and attempting to connect.
   void setup() override;
   void dump_config() override;
@@ -276,7 +291,7 @@ class MQTTClientComponent : public Component {
   void check_dnslookup_();
 #if defined(USE_ESP8266) && LWIP_VERSION_MAJOR == 1
   static void dns_found_callback(const char *name, ip_addr_t *ipaddr, void *callback_arg);
-#else
+#elif !defined(USE_HOST)
   static void dns_found_callback(const char *name, const ip_addr_t *ipaddr, void *callback_arg);
 #endif
 
@@ -286,6 +301,12 @@ class MQTTClientComponent : public Component {
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
+  /// Call the callbacks of all subscriptions matching the topic.
+  void dispatch_message_(const std::string &topic, const std::string &payload);
+  /// Send the discovery and the state of the next few components after connecting, while the outbox has space.
+  void send_pending_discovery_();
+  /// The topic filter matching the discovery configs of all components of this node.
+  std::string get_discovery_config_filter_() const;
 
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
@@ -311,15 +332,24 @@ class MQTTClientComponent : public Component {
   std::string topic_prefix_{};
   MQTTMessage log_message_;
   std::string payload_buffer_;
+  json::JsonWriter json_writer_;
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Topic filters of subscriptions_, by index.
+  MQTTTopicTrie subscription_trie_;
+  /// Reused buffer for the subscriptions matching a message.
+  std::vector<uint16_t> matches_;
+  /// Incremented whenever subscriptions are removed and the indices in the trie change.
+  uint32_t subscriptions_generation_{0};
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
   MQTTBackendESP8266 mqtt_backend_;
 #elif defined(USE_LIBRETINY)
   MQTTBackendLibreTiny mqtt_backend_;
+#elif defined(USE_HOST)
+  MQTTBackendHost mqtt_backend_;
 #endif
 
   MQTTClientState state_{MQTT_CLIENT_DISABLED};
@@ -332,6 +362,17 @@ class MQTTClientComponent : public Component {
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
   optional<MQTTClientDisconnectReason> disconnect_reason_{};
+  /// Index of the next component in children_ to send the discovery and state of, kept across reconnects.
+  size_t discovery_index_{0};
+  /// Components left to send the discovery and state of since connecting.
+  size_t discovery_remaining_{0};
+  /// Hashes of the retained discovery topics and configs the broker sent for this node since connecting.
+  std::unordered_set<uint32_t> retained_discovery_;
+  /// When the last retained discovery config arrived, or the connection was established.
+  uint32_t last_retained_discovery_{0};
+  /// Whether the retained discovery configs are still arriving, the components are walked once they stopped.
+  bool discovery_waiting_for_retained_{false};
+  bool retained_discovery_subscribed_{false};
 
   bool publish_nan_as_none_{false};
 };
@@ -115,6 +115,14 @@ class MQTTComponent : public Component {
   /// Internal method for the MQTT client base to schedule a resend of the state on reconnect.
   void schedule_resend_state();
 
+  /** Internal method for the MQTT client base to send the discovery and the state after connecting.
+   *
+   * The discovery is skipped if the broker sent the same config as retained after connecting.
+   *
+   * @return false if the discovery couldn't be sent and this has to be retried.
+   */
+  bool send_discovery_and_state();
+
   /** Send a MQTT message.
    *
    * @param topic The topic.
@@ -129,6 +137,13 @@ class MQTTComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f);
 
+  /** Send a JSON MQTT message that has already been written.
+   *
+   * @param topic The topic.
+   * @param json The writer holding the message, usually the one from MQTTClientComponent::get_json_writer().
+   */
+  bool publish_json(const std::string &topic, const json::JsonWriter &json);
+
   /** Subscribe to a MQTT topic.
    *
    * @param topic The topic. Wildcards are currently not supported.
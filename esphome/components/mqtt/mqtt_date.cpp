@@ -54,11 +54,13 @@ bool MQTTDateComponent::send_initial_state() {
   }
 }
 bool MQTTDateComponent::publish_state(uint16_t year, uint8_t month, uint8_t day) {
-  return this->publish_json(this->get_state_topic_(), [year, month, day](JsonObject root) {
-    root["year"] = year;
-    root["month"] = month;
-    root["day"] = day;
-  });
+  json::JsonWriter &json = global_mqtt_client->get_json_writer();
+  json.begin_object();
+  json.add("year", year);
+  json.add("month", month);
+  json.add("day", day);
+  json.end_object();
+  return this->publish_json(this->get_state_topic_(), json);
 }
 
 }  // namespace mqtt
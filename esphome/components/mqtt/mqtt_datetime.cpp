@@ -67,14 +67,16 @@ bool MQTTDateTimeComponent::send_initial_state() {
 }
 bool MQTTDateTimeComponent::publish_state(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute,
                                           uint8_t second) {
-  return this->publish_json(this->get_state_topic_(), [year, month, day, hour, minute, second](JsonObject root) {
-    root["year"] = year;
-    root["month"] = month;
-    root["day"] = day;
-    root["hour"] = hour;
-    root["minute"] = minute;
-    root["second"] = second;
-  });
+  json::JsonWriter &json = global_mqtt_client->get_json_writer();
+  json.begin_object();
+  json.add("year", year);
+  json.add("month", month);
+  json.add("day", day);
+  json.add("hour", hour);
+  json.add("minute", minute);
+  json.add("second", second);
+  json.end_object();
+  return this->publish_json(this->get_state_topic_(), json);
 }
 
 }  // namespace mqtt
@@ -40,8 +40,11 @@ void MQTTEventComponent::dump_config() {
 }
 
 bool MQTTEventComponent::publish_event_(const std::string &event_type) {
-  return this->publish_json(this->get_state_topic_(),
-                            [event_type](JsonObject root) { root[MQTT_EVENT_TYPE] = event_type; });
+  json::JsonWriter &json = global_mqtt_client->get_json_writer();
+  json.begin_object();
+  json.add(MQTT_EVENT_TYPE, event_type);
+  json.end_object();
+  return this->publish_json(this->get_state_topic_(), json);
 }
 
 std::string MQTTEventComponent::component_type() const { return "event"; }
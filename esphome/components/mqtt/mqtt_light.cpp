@@ -32,8 +32,11 @@ void MQTTJSONLightComponent::setup() {
 MQTTJSONLightComponent::MQTTJSONLightComponent(LightState *state) : state_(state) {}
 
 bool MQTTJSONLightComponent::publish_state_() {
-  return this->publish_json(this->get_state_topic_(),
-                            [this](JsonObject root) { LightJSONSchema::dump_json(*this->state_, root); });
+  json::JsonWriter &json = global_mqtt_client->get_json_writer();
+  json.begin_object();
+  LightJSONSchema::dump_json(*this->state_, json);
+  json.end_object();
+  return this->publish_json(this->get_state_topic_(), json);
 }
 LightState *MQTTJSONLightComponent::get_state() const { return this->state_; }
 
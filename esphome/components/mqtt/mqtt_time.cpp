@@ -54,11 +54,13 @@ bool MQTTTimeComponent::send_initial_state() {
   }
 }
 bool MQTTTimeComponent::publish_state(uint8_t hour, uint8_t minute, uint8_t second) {
-  return this->publish_json(this->get_state_topic_(), [hour, minute, second](JsonObject root) {
-    root["hour"] = hour;
-    root["minute"] = minute;
-    root["second"] = second;
-  });
+  json::JsonWriter &json = global_mqtt_client->get_json_writer();
+  json.begin_object();
+  json.add("hour", hour);
+  json.add("minute", minute);
+  json.add("second", second);
+  json.end_object();
+  return this->publish_json(this->get_state_topic_(), json);
 }
 
 }  // namespace mqtt
@@ -0,0 +1,92 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+void MQTTTopicTrie::insert(const std::string &filter, uint16_t index) {
+  if (this->nodes_.empty())
+    this->nodes_.emplace_back();
+  uint16_t node = 0;
+  size_t start = 0;
+  while (true) {
+    size_t end = filter.find('/', start);
+    size_t length = (end == std::string::npos ? filter.size() : end) - start;
+    if (length == 1 && filter[start] == '#') {
+      this->nodes_[node].multi_level.push_back(index);
+      return;
+    }
+    node = this->child_(node, filter.c_str() + start, length);
+    if (end == std::string::npos)
+      break;
+    start = end + 1;
+  }
+  this->nodes_[node].subscriptions.push_back(index);
+}
+
+void MQTTTopicTrie::clear() { this->nodes_.clear(); }
+
+uint16_t MQTTTopicTrie::child_(uint16_t parent, const char *level, size_t length) {
+  if (length == 1 && *level == '+') {
+    if (this->nodes_[parent].single_level == 0) {
+      this->nodes_.emplace_back();
+      this->nodes_.back().level = "+";
+      this->nodes_[parent].single_level = this->nodes_.size() - 1;
+    }
+    return this->nodes_[parent].single_level;
+  }
+  auto &children = this->nodes_[parent].children;
+  auto it = std::lower_bound(children.begin(), children.end(), 0, [this, level, length](uint16_t child, int) {
+    return this->nodes_[child].level.compare(0, std::string::npos, level, length) < 0;
+  });
+  if (it != children.end() && this->nodes_[*it].level.compare(0, std::string::npos, level, length) == 0)
+    return *it;
+  uint16_t child = this->nodes_.size();
+  children.insert(it, child);
+  // children is a reference into nodes_, so only grow nodes_ once it has been updated
+  this->nodes_.emplace_back();
+  this->nodes_.back().level.assign(level, length);
+  return child;
+}
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<uint16_t> &matches) const {
+  if (this->nodes_.empty())
+    return;
+  size_t first = matches.size();
+  // wildcards in the first level don't match topics starting with $
+  this->match_(0, topic.c_str(), topic.empty() || topic[0] != '$', matches);
+  // filters are matched level by level, restore the order in which they were subscribed
+  std::sort(matches.begin() + first, matches.end());
+}
+
+void MQTTTopicTrie::match_(uint16_t index, const char *topic, bool wildcards,
+                           std::vector<uint16_t> &matches) const {
+  const Node &node = this->nodes_[index];
+  if (wildcards)
+    matches.insert(matches.end(), node.multi_level.begin(), node.multi_level.end());
+  if (topic == nullptr) {
+    // all levels of the topic are consumed
+    matches.insert(matches.end(), node.subscriptions.begin(), node.subscriptions.end());
+    return;
+  }
+  const char *end = strchr(topic, '/');
+  size_t length = end == nullptr ? strlen(topic) : end - topic;
+  const char *next = end == nullptr ? nullptr : end + 1;
+
+  auto it = std::lower_bound(node.children.begin(), node.children.end(), 0, [this, topic, length](uint16_t child, int) {
+    return this->nodes_[child].level.compare(0, std::string::npos, topic, length) < 0;
+  });
+  if (it != node.children.end() && this->nodes_[*it].level.compare(0, std::string::npos, topic, length) == 0)
+    this->match_(*it, next, true, matches);
+  if (wildcards && node.single_level != 0)
+    this->match_(node.single_level, next, true, matches);
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Index of subscription topic filters, split into topic levels.
+ *
+ * Matching an incoming topic walks the levels of the topic once, following the literal and the `+` child of each
+ * node and collecting the `#` filters on the way, instead of comparing the topic with every subscription.
+ *
+ * Wildcards follow the MQTT spec: `+` matches exactly one level, `#` must be the last level and matches any number of
+ * levels including the parent level (`a/#` matches `a`), and topics starting with `$` are not matched by a wildcard
+ * in the first level.
+ */
+class MQTTTopicTrie {
+ public:
+  /// Add a topic filter with the index of its subscription. Indices must be added in ascending order.
+  void insert(const std::string &filter, uint16_t index);
+  /// Remove all topic filters.
+  void clear();
+  /// Append the indices of all subscriptions whose filter matches the topic in ascending order.
+  void match(const std::string &topic, std::vector<uint16_t> &matches) const;
+
+ protected:
+  struct Node {
+    std::string level;
+    /// Literal child levels, sorted by level.
+    std::vector<uint16_t> children;
+    /// The `+` child, 0 if there is none as the root is never a child.
+    uint16_t single_level{0};
+    /// Subscriptions whose filter ends at this node.
+    std::vector<uint16_t> subscriptions;
+    /// Subscriptions whose filter ends with a `#` below this node.
+    std::vector<uint16_t> multi_level;
+  };
+
+  uint16_t child_(uint16_t parent, const char *level, size_t length);
+  void match_(uint16_t index, const char *topic, bool wildcards, std::vector<uint16_t> &matches) const;
+
+  std::vector<Node> nodes_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
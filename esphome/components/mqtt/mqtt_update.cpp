@@ -29,15 +29,18 @@ void MQTTUpdateComponent::setup() {
 }
 
 bool MQTTUpdateComponent::publish_state() {
-  return this->publish_json(this->get_state_topic_(), [this](JsonObject root) {
-    root["installed_version"] = this->update_->update_info.current_version;
-    root["latest_version"] = this->update_->update_info.latest_version;
-    root["title"] = this->update_->update_info.title;
-    if (!this->update_->update_info.summary.empty())
-      root["release_summary"] = this->update_->update_info.summary;
-    if (!this->update_->update_info.release_url.empty())
-      root["release_url"] = this->update_->update_info.release_url;
-  });
+  const auto &info = this->update_->update_info;
+  json::JsonWriter &json = global_mqtt_client->get_json_writer();
+  json.begin_object();
+  json.add("installed_version", info.current_version);
+  json.add("latest_version", info.latest_version);
+  json.add("title", info.title);
+  if (!info.summary.empty())
+    json.add("release_summary", info.summary);
+  if (!info.release_url.empty())
+    json.add("release_url", info.release_url);
+  json.end_object();
+  return this->publish_json(this->get_state_topic_(), json);
 }
 
 void MQTTUpdateComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
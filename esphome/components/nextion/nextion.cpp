@@ -125,10 +125,9 @@ bool Nextion::check_connect_() {
 }
 
 void Nextion::reset_(bool reset_nextion) {
-  uint8_t d;
+  uint8_t buf[64];
 
-  while (this->available()) {  // Clear receive buffer
-    this->read_byte(&d);
+  while (this->read_available(buf, sizeof(buf)) > 0) {  // Clear receive buffer
   };
   this->nextion_queue_.clear();
   this->waveform_queue_.clear();
@@ -328,11 +327,11 @@ bool Nextion::remove_from_q_(bool report_empty) {
 }
 
 void Nextion::process_serial_() {
-  uint8_t d;
+  uint8_t buf[64];
+  size_t len;
 
-  while (this->available()) {
-    read_byte(&d);
-    this->command_data_ += d;
+  while ((len = this->read_available(buf, sizeof(buf))) > 0) {
+    this->command_data_.append(reinterpret_cast<const char *>(buf), len);
   }
 }
 // nextion.tech/instruction-set/
@@ -342,24 +341,27 @@ void Nextion::process_nextion_commands_() {
   }
 
   size_t to_process_length = 0;
+  // Start of the next command in command_data_, the processed commands are erased at once afterwards
+  size_t start = 0;
   std::string to_process;
 
   ESP_LOGN(TAG, "this->command_data_ %s length %d", this->command_data_.c_str(), this->command_data_.length());
 #ifdef NEXTION_PROTOCOL_LOG
   this->print_queue_members_();
 #endif
-  while ((to_process_length = this->command_data_.find(COMMAND_DELIMITER)) != std::string::npos) {
+  while ((to_process_length = this->command_data_.find(COMMAND_DELIMITER, start)) != std::string::npos) {
+    to_process_length -= start;
     ESP_LOGN(TAG, "print_queue_members_ size %zu", this->nextion_queue_.size());
-    while (to_process_length + COMMAND_DELIMITER.length() < this->command_data_.length() &&
-           static_cast<uint8_t>(this->command_data_[to_process_length + COMMAND_DELIMITER.length()]) == 0xFF) {
+    while (start + to_process_length + COMMAND_DELIMITER.length() < this->command_data_.length() &&
+           static_cast<uint8_t>(this->command_data_[start + to_process_length + COMMAND_DELIMITER.length()]) == 0xFF) {
       ++to_process_length;
       ESP_LOGN(TAG, "Add extra 0xFF to process");
     }
 
-    this->nextion_event_ = this->command_data_[0];
+    this->nextion_event_ = this->command_data_[start];
 
     to_process_length -= 1;
-    to_process = this->command_data_.substr(1, to_process_length);
+    to_process = this->command_data_.substr(start + 1, to_process_length);
 
     switch (this->nextion_event_) {
       case 0x00:  // instruction sent by user has failed
@@ -768,11 +770,11 @@ void Nextion::process_nextion_commands_() {
         break;
     }
 
-    // ESP_LOGN(TAG, "nextion_event_ deleting from 0 to %d", to_process_length + COMMAND_DELIMITER.length() + 1);
-    this->command_data_.erase(0, to_process_length + COMMAND_DELIMITER.length() + 1);
+    start += to_process_length + COMMAND_DELIMITER.length() + 1;
     // App.feed_wdt(); Remove before master merge
     this->process_serial_();
   }
+  this->command_data_.erase(0, start);
 
   uint32_t ms = millis();
 
@@ -0,0 +1,168 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace profiler {
+
+static const char *const TAG = "profiler";
+
+Profiler *global_profiler = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void ProfileStats::record(uint32_t us) {
+  this->count++;
+  this->total_us += us;
+  if (us > this->max_us)
+    this->max_us = us;
+  // Bucket n holds values in [2^(n-1), 2^n), the last bucket everything above
+  uint8_t bucket = us == 0 ? 0 : 32 - __builtin_clz(us);
+  if (bucket >= BUCKETS)
+    bucket = BUCKETS - 1;
+  if (this->histogram[bucket] != UINT16_MAX)
+    this->histogram[bucket]++;
+}
+ProfileSummary ProfileStats::take() {
+  ProfileSummary summary;
+  summary.count = this->count;
+  summary.total_us = this->total_us;
+  summary.max_us = this->max_us;
+
+  uint32_t seen = 0;
+  uint32_t total = 0;
+  for (auto n : this->histogram)
+    total += n;
+  // Report the upper end of the bucket that contains the 99th percentile, but never more than the maximum
+  const uint32_t rank = total - total / 100;
+  for (uint8_t i = 0; i < BUCKETS && total != 0; i++) {
+    seen += this->histogram[i];
+    if (seen >= rank) {
+      summary.p99_us = i == BUCKETS - 1 ? this->max_us : std::min<uint32_t>(this->max_us, (1UL << i) - 1);
+      break;
+    }
+  }
+
+  *this = ProfileStats{};
+  return summary;
+}
+
+const char *ComponentProfile::get_source() const {
+  if (this->component == nullptr)
+    return "<scheduler>";
+  return this->component->get_component_source();
+}
+
+Profiler::Profiler() { global_profiler = this; }
+
+void Profiler::setup() { this->window_start_ = millis(); }
+
+void Profiler::record_loop(Component *component, uint32_t us) { this->get_profile_(component)->loop.record(us); }
+void Profiler::record_scheduler(Component *component, uint32_t us) {
+  this->get_profile_(component)->scheduler.record(us);
+}
+void Profiler::record_iteration_start(uint32_t now_us) {
+  if (this->iteration_start_us_ != 0) {
+    const uint32_t period = now_us - this->iteration_start_us_;
+    if (this->last_period_us_ != 0) {
+      this->loop_jitter_.record(period > this->last_period_us_ ? period - this->last_period_us_
+                                                               : this->last_period_us_ - period);
+    }
+    this->last_period_us_ = period;
+  }
+  this->iteration_start_us_ = now_us;
+}
+void Profiler::record_iteration_end(uint32_t now_us) { this->loop_time_.record(now_us - this->iteration_start_us_); }
+
+ComponentProfile *Profiler::get_profile_(Component *component) {
+  auto it = this->profiles_.find(component);
+  if (it != this->profiles_.end())
+    return &it->second;
+  ComponentProfile *profile = &this->profiles_[component];
+  profile->component = component;
+  this->components_.push_back(profile);
+  return profile;
+}
+
+void Profiler::update() {
+  const uint32_t now = millis();
+  this->last_window_ms_ = now - this->window_start_;
+  this->window_start_ = now;
+
+  this->last_loop_time_ = this->loop_time_.take();
+  this->last_loop_jitter_ = this->loop_jitter_.take();
+  ComponentProfile *busiest = nullptr;
+  uint32_t busiest_us = 0;
+  for (auto *profile : this->components_) {
+    profile->last_loop = profile->loop.take();
+    profile->last_scheduler = profile->scheduler.take();
+    const uint32_t total_us = profile->last_loop.total_us + profile->last_scheduler.total_us;
+    if (busiest == nullptr || total_us > busiest_us) {
+      busiest = profile;
+      busiest_us = total_us;
+    }
+  }
+
+  {
+    LockGuard guard(this->report_lock_);
+    this->report_.window_ms = this->last_window_ms_;
+    this->report_.loop_time = this->last_loop_time_;
+    this->report_.loop_jitter = this->last_loop_jitter_;
+    this->report_.components.resize(this->components_.size());
+    for (size_t i = 0; i < this->components_.size(); i++) {
+      const ComponentProfile *profile = this->components_[i];
+      this->report_.components[i] = {profile->get_source(), profile->last_loop, profile->last_scheduler};
+    }
+  }
+
+  ESP_LOGD(TAG, "Loop time: max=%" PRIu32 "us p99=%" PRIu32 "us, jitter: max=%" PRIu32 "us p99=%" PRIu32 "us",
+           this->last_loop_time_.max_us, this->last_loop_time_.p99_us, this->last_loop_jitter_.max_us,
+           this->last_loop_jitter_.p99_us);
+  if (busiest != nullptr) {
+    ESP_LOGD(TAG, "Busiest component: %s (%" PRIu32 "us in %" PRIu32 "ms)", busiest->get_source(), busiest_us,
+             this->last_window_ms_);
+  }
+
+#ifdef USE_SENSOR
+  if (this->loop_time_max_sensor_ != nullptr)
+    this->loop_time_max_sensor_->publish_state(this->last_loop_time_.max_us);
+  if (this->loop_time_p99_sensor_ != nullptr)
+    this->loop_time_p99_sensor_->publish_state(this->last_loop_time_.p99_us);
+  if (this->loop_jitter_max_sensor_ != nullptr)
+    this->loop_jitter_max_sensor_->publish_state(this->last_loop_jitter_.max_us);
+  if (this->loop_jitter_p99_sensor_ != nullptr)
+    this->loop_jitter_p99_sensor_->publish_state(this->last_loop_jitter_.p99_us);
+  if (this->busiest_component_time_sensor_ != nullptr)
+    this->busiest_component_time_sensor_->publish_state(busiest_us);
+#endif
+#ifdef USE_TEXT_SENSOR
+  if (this->busiest_component_sensor_ != nullptr && busiest != nullptr)
+    this->busiest_component_sensor_->publish_state(busiest->get_source());
+#endif
+}
+
+ProfileReport Profiler::get_report() {
+  LockGuard guard(this->report_lock_);
+  return this->report_;
+}
+
+void Profiler::dump_config() {
+  ESP_LOGCONFIG(TAG, "Profiler:");
+  LOG_UPDATE_INTERVAL(this);
+#ifdef USE_SENSOR
+  LOG_SENSOR("  ", "Loop Time Max", this->loop_time_max_sensor_);
+  LOG_SENSOR("  ", "Loop Time P99", this->loop_time_p99_sensor_);
+  LOG_SENSOR("  ", "Loop Jitter Max", this->loop_jitter_max_sensor_);
+  LOG_SENSOR("  ", "Loop Jitter P99", this->loop_jitter_p99_sensor_);
+  LOG_SENSOR("  ", "Busiest Component Time", this->busiest_component_time_sensor_);
+#endif
+#ifdef USE_TEXT_SENSOR
+  LOG_TEXT_SENSOR("  ", "Busiest Component", this->busiest_component_sensor_);
+#endif
+}
+
+float Profiler::get_setup_priority() const { return setup_priority::LATE; }
+
+}  // namespace profiler
+}  // namespace esphome
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+
+namespace esphome {
+namespace profiler {
+
+/// Aggregated timing of one profiling window.
+struct ProfileSummary {
+  uint32_t count{0};
+  uint32_t total_us{0};
+  uint32_t max_us{0};
+  uint32_t p99_us{0};
+};
+
+/// Running statistics with a power-of-two histogram, used to estimate the 99th percentile.
+struct ProfileStats {
+  static const uint8_t BUCKETS = 16;
+
+  uint32_t count{0};
+  uint32_t total_us{0};
+  uint32_t max_us{0};
+  uint16_t histogram[BUCKETS]{};
+
+  void record(uint32_t us);
+  /// Summarize the recorded values and start over.
+  ProfileSummary take();
+};
+
+struct ComponentProfile {
+  /// Owner of the measured work, nullptr for scheduler items registered without a component.
+  Component *component;
+  /// Time spent in loop().
+  ProfileStats loop;
+  /// Time spent in timeouts/intervals scheduled by this component.
+  ProfileStats scheduler;
+  ProfileSummary last_loop;
+  ProfileSummary last_scheduler;
+
+  const char *get_source() const;
+};
+
+/// Summaries of one component in a ProfileReport.
+struct ComponentReport {
+  const char *source;
+  ProfileSummary loop;
+  ProfileSummary scheduler;
+};
+
+/// Copy of the summaries of the last completed window.
+struct ProfileReport {
+  uint32_t window_ms{0};
+  ProfileSummary loop_time;
+  ProfileSummary loop_jitter;
+  std::vector<ComponentReport> components;
+};
+
+/** Records where the main loop spends its time.
+ *
+ * Application::loop() and the Scheduler report every component call to the global profiler. The values are
+ * aggregated over a window of update_interval; after every window the summaries are published to the sensors and
+ * are what the API and web server report.
+ */
+class Profiler : public PollingComponent {
+ public:
+  Profiler();
+
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+  void record_loop(Component *component, uint32_t us);
+  void record_scheduler(Component *component, uint32_t us);
+  /// Called at the start of every Application::loop() iteration.
+  void record_iteration_start(uint32_t now_us);
+  /// Called when the work of an iteration is done, before the main loop goes to sleep.
+  void record_iteration_end(uint32_t now_us);
+
+  /// Per-component summaries of the last completed window, in the order the components first ran.
+  const std::vector<ComponentProfile *> &get_components() const { return this->components_; }
+  /// Active time of an Application::loop() iteration, excluding the sleep at its end.
+  const ProfileSummary &get_loop_time() const { return this->last_loop_time_; }
+  /// Difference between the periods of two consecutive loop iterations.
+  const ProfileSummary &get_loop_jitter() const { return this->last_loop_jitter_; }
+  uint32_t get_window_ms() const { return this->last_window_ms_; }
+  /// Copy of the summaries of the last completed window. Unlike the getters above, this can be called from other
+  /// tasks, like the one of the web server.
+  ProfileReport get_report();
+
+#ifdef USE_SENSOR
+  void set_loop_time_max_sensor(sensor::Sensor *sensor) { this->loop_time_max_sensor_ = sensor; }
+  void set_loop_time_p99_sensor(sensor::Sensor *sensor) { this->loop_time_p99_sensor_ = sensor; }
+  void set_loop_jitter_max_sensor(sensor::Sensor *sensor) { this->loop_jitter_max_sensor_ = sensor; }
+  void set_loop_jitter_p99_sensor(sensor::Sensor *sensor) { this->loop_jitter_p99_sensor_ = sensor; }
+  void set_busiest_component_time_sensor(sensor::Sensor *sensor) { this->busiest_component_time_sensor_ = sensor; }
+#endif
+#ifdef USE_TEXT_SENSOR
+  void set_busiest_component_sensor(text_sensor::TextSensor *sensor) { this->busiest_component_sensor_ = sensor; }
+#endif
+
+ protected:
+  ComponentProfile *get_profile_(Component *component);
+
+  std::unordered_map<Component *, ComponentProfile> profiles_;
+  std::vector<ComponentProfile *> components_;
+  ProfileStats loop_time_;
+  ProfileStats loop_jitter_;
+  ProfileSummary last_loop_time_;
+  ProfileSummary last_loop_jitter_;
+  uint32_t iteration_start_us_{0};
+  uint32_t last_period_us_{0};
+  uint32_t window_start_{0};
+  uint32_t last_window_ms_{0};
+  /// Written by update() on the main loop, read by get_report() from any task.
+  ProfileReport report_;
+  Mutex report_lock_;
+
+#ifdef USE_SENSOR
+  sensor::Sensor *loop_time_max_sensor_{nullptr};
+  sensor::Sensor *loop_time_p99_sensor_{nullptr};
+  sensor::Sensor *loop_jitter_max_sensor_{nullptr};
+  sensor::Sensor *loop_jitter_p99_sensor_{nullptr};
+  sensor::Sensor *busiest_component_time_sensor_{nullptr};
+#endif
+#ifdef USE_TEXT_SENSOR
+  text_sensor::TextSensor *busiest_component_sensor_{nullptr};
+#endif
+};
+
+extern Profiler *global_profiler;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace profiler
+}  // namespace esphome
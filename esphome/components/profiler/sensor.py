@@ -0,0 +1,51 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+)
+from . import CONF_PROFILER_ID, Profiler
+
+DEPENDENCIES = ["profiler"]
+
+CONF_BUSIEST_COMPONENT_TIME = "busiest_component_time"
+CONF_LOOP_JITTER_MAX = "loop_jitter_max"
+CONF_LOOP_JITTER_P99 = "loop_jitter_p99"
+CONF_LOOP_TIME_MAX = "loop_time_max"
+CONF_LOOP_TIME_P99 = "loop_time_p99"
+
+UNIT_MICROSECOND = "µs"
+
+_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_MICROSECOND,
+    icon=ICON_TIMER,
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+SENSORS = (
+    CONF_LOOP_TIME_MAX,
+    CONF_LOOP_TIME_P99,
+    CONF_LOOP_JITTER_MAX,
+    CONF_LOOP_JITTER_P99,
+    CONF_BUSIEST_COMPONENT_TIME,
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_PROFILER_ID): cv.use_id(Profiler),
+        **{cv.Optional(key): _SENSOR_SCHEMA for key in SENSORS},
+    }
+)
+
+
+async def to_code(config):
+    profiler = await cg.get_variable(config[CONF_PROFILER_ID])
+
+    for key in SENSORS:
+        if sensor_config := config.get(key):
+            sens = await sensor.new_sensor(sensor_config)
+            cg.add(getattr(profiler, f"set_{key}_sensor")(sens))
@@ -0,0 +1,28 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import text_sensor
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, ICON_CHIP
+
+from . import CONF_PROFILER_ID, Profiler
+
+DEPENDENCIES = ["profiler"]
+
+CONF_BUSIEST_COMPONENT = "busiest_component"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_PROFILER_ID): cv.use_id(Profiler),
+        cv.Optional(CONF_BUSIEST_COMPONENT): text_sensor.text_sensor_schema(
+            icon=ICON_CHIP,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    profiler = await cg.get_variable(config[CONF_PROFILER_ID])
+
+    if busiest_component_config := config.get(CONF_BUSIEST_COMPONENT):
+        sens = await text_sensor.new_text_sensor(busiest_component_config)
+        cg.add(profiler.set_busiest_component_sensor(sens))
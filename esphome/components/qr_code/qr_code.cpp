@@ -1,5 +1,6 @@
 #include "qr_code.h"
 #include "esphome/components/display/display.h"
+#include "esphome/core/application.h"
 #include "esphome/core/color.h"
 #include "esphome/core/log.h"
 
@@ -49,6 +50,7 @@ void QrCode::draw(display::Display *buff, uint16_t x_offset, uint16_t y_offset,
         buff->draw_pixel_at(x_offset + x, y_offset + y, color);
       }
     }
+    App.feed_wdt();
   }
 }
 
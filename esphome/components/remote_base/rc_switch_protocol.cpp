@@ -239,9 +239,18 @@ uint64_t decode_binary_string_mask(const std::string &data) {
 }
 
 bool RCSwitchRawReceiver::matches(RemoteReceiveData src) {
-  uint64_t decoded_code;
-  uint8_t decoded_nbits;
-  if (!this->protocol_.decode(src, &decoded_code, &decoded_nbits))
+  // Receivers with the same protocol decode a burst identically, so only the first one of them decodes it
+  static uint32_t decoded_burst = 0;
+  static RCSwitchBase decoded_protocol;
+  static bool decoded = false;
+  static uint64_t decoded_code;
+  static uint8_t decoded_nbits;
+  if (src.get_burst() == 0 || src.get_burst() != decoded_burst || !(this->protocol_ == decoded_protocol)) {
+    decoded_burst = src.get_burst();
+    decoded_protocol = this->protocol_;
+    decoded = this->protocol_.decode(src, &decoded_code, &decoded_nbits);
+  }
+  if (!decoded)
     return false;
 
   return decoded_nbits == this->nbits_ && (decoded_code & this->mask_) == (this->code_ & this->mask_);
@@ -52,6 +52,12 @@ class RCSwitchBase {
 
   static void type_d_code(uint8_t group, uint8_t device, bool state, uint64_t *out_code, uint8_t *out_nbits);
 
+  bool operator==(const RCSwitchBase &rhs) const {
+    return this->sync_high_ == rhs.sync_high_ && this->sync_low_ == rhs.sync_low_ &&
+           this->zero_high_ == rhs.zero_high_ && this->zero_low_ == rhs.zero_low_ &&
+           this->one_high_ == rhs.one_high_ && this->one_low_ == rhs.one_low_ && this->inverted_ == rhs.inverted_;
+  }
+
  protected:
   uint32_t sync_high_{};
   uint32_t sync_low_{};
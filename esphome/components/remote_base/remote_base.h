@@ -47,10 +47,13 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t burst = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), burst_(burst) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
+  /// Identifies the received burst this data belongs to, 0 if it's not from a receiver.
+  uint32_t get_burst() const { return this->burst_; }
   uint32_t get_index() const { return index_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
@@ -99,6 +102,7 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t burst_;
 };
 
 class RemoteComponentBase {
@@ -215,9 +219,9 @@ class RemoteReceiverBase : public RemoteComponentBase {
  protected:
   void call_listeners_();
   void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
+  void call_listeners_dumpers_();
+  RemoteReceiveData get_data_() const {
+    return RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->burst_);
   }
 
   std::vector<RemoteReceiverListener *> listeners_;
@@ -226,6 +230,7 @@ class RemoteReceiverBase : public RemoteComponentBase {
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
+  uint32_t burst_{0};
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -248,14 +253,31 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/** Decode a received burst with protocol T, at most once per burst.
+ *
+ * All binary sensors, triggers and dumpers of a protocol share the result, so a burst is decoded once per configured
+ * protocol instead of once per listener (e.g. 30 binary sensors on an RF bridge). The result stays valid until the
+ * next burst is decoded with the same protocol.
+ */
+template<typename T> const optional<typename T::ProtocolData> &decode_shared(const RemoteReceiveData &src) {
+  static uint32_t burst = 0;
+  static optional<typename T::ProtocolData> result;
+  if (src.get_burst() == 0 || src.get_burst() != burst) {
+    burst = src.get_burst();
+    auto proto = T();
+    RemoteReceiveData data = src;
+    result = proto.decode(data);
+  }
+  return result;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    const auto &res = decode_shared<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -270,8 +292,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    const auto &res = decode_shared<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -313,7 +334,7 @@ template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBas
  public:
   bool dump(RemoteReceiveData src) override {
     auto proto = T();
-    auto decoded = proto.decode(src);
+    const auto &decoded = decode_shared<T>(src);
     if (!decoded.has_value())
       return false;
     proto.dump(*decoded);
@@ -41,6 +41,8 @@ void SafeModeComponent::loop() {
     ESP_LOGI(TAG, "Boot seems successful; resetting boot loop counter");
     this->clean_rtc();
     this->boot_successful_ = true;
+    // Nothing left to do in loop()
+    this->disable_loop();
   }
 }
 
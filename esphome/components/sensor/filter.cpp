@@ -31,40 +31,130 @@ void Filter::initialize(Sensor *parent, Filter *next) {
   this->next_ = next;
 }
 
+// OrderStatisticWindow
+void OrderStatisticWindow::set_window_size(size_t window_size) {
+  // push() always needs a slot
+  window_size = std::max<size_t>(window_size, 1);
+  // Oldest to newest, dropping what no longer fits
+  std::vector<float> kept;
+  const size_t keep = std::min(this->count_, window_size);
+  kept.reserve(keep);
+  for (size_t i = this->count_ - keep; i < this->count_; i++)
+    kept.push_back(this->values_[(this->head_ + this->values_.size() - this->count_ + i) % this->values_.size()]);
+
+  this->values_.assign(window_size, NAN);
+  this->slot_pos_.assign(window_size, NOT_IN_HEAP);
+  this->lower_.clear();
+  this->lower_.reserve(window_size);
+  this->upper_.clear();
+  this->upper_.reserve(window_size);
+  this->head_ = 0;
+  this->count_ = 0;
+  for (float value : kept)
+    this->push(value);
+}
+void OrderStatisticWindow::push(float value) {
+  const uint32_t slot = this->head_;
+  if (this->count_ == this->values_.size()) {
+    const uint32_t pos = this->slot_pos_[slot];
+    if (pos != NOT_IN_HEAP)
+      this->heap_remove_(pos & UPPER_HEAP, pos & ~UPPER_HEAP);
+  } else {
+    this->count_++;
+  }
+  this->values_[slot] = value;
+  this->slot_pos_[slot] = NOT_IN_HEAP;
+  if (!std::isnan(value)) {
+    // Every value in the lower heap is <= every value in the upper heap, either heap keeps that true
+    const bool upper = !this->upper_.empty() && value >= this->upper_min();
+    this->heap_push_(upper, slot);
+  }
+  if (++this->head_ == this->values_.size())
+    this->head_ = 0;
+}
+void OrderStatisticWindow::partition(size_t count) {
+  while (this->lower_.size() > count) {
+    const uint32_t slot = this->lower_.front();
+    this->heap_remove_(false, 0);
+    this->heap_push_(true, slot);
+  }
+  while (this->lower_.size() < count) {
+    const uint32_t slot = this->upper_.front();
+    this->heap_remove_(true, 0);
+    this->heap_push_(false, slot);
+  }
+}
+void OrderStatisticWindow::heap_push_(bool upper, uint32_t slot) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  heap.push_back(slot);
+  this->heap_place_(upper, heap.size() - 1, slot);
+  this->sift_up_(upper, heap.size() - 1);
+}
+void OrderStatisticWindow::heap_remove_(bool upper, size_t pos) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  this->slot_pos_[heap[pos]] = NOT_IN_HEAP;
+  const uint32_t last = heap.back();
+  heap.pop_back();
+  if (pos == heap.size())
+    return;
+  this->heap_place_(upper, pos, last);
+  this->sift_up_(upper, pos);
+  this->sift_down_(upper, this->slot_pos_[last] & ~UPPER_HEAP);
+}
+void OrderStatisticWindow::heap_place_(bool upper, size_t pos, uint32_t slot) {
+  (upper ? this->upper_ : this->lower_)[pos] = slot;
+  this->slot_pos_[slot] = upper ? pos | UPPER_HEAP : pos;
+}
+void OrderStatisticWindow::sift_up_(bool upper, size_t pos) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  const uint32_t slot = heap[pos];
+  while (pos > 0) {
+    const size_t parent = (pos - 1) / 2;
+    if (!this->before_(upper, slot, heap[parent]))
+      break;
+    this->heap_place_(upper, pos, heap[parent]);
+    pos = parent;
+  }
+  this->heap_place_(upper, pos, slot);
+}
+void OrderStatisticWindow::sift_down_(bool upper, size_t pos) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  const uint32_t slot = heap[pos];
+  while (true) {
+    size_t child = 2 * pos + 1;
+    if (child >= heap.size())
+      break;
+    if (child + 1 < heap.size() && this->before_(upper, heap[child + 1], heap[child]))
+      child++;
+    if (!this->before_(upper, heap[child], slot))
+      break;
+    this->heap_place_(upper, pos, heap[child]);
+    pos = child;
+  }
+  this->heap_place_(upper, pos, slot);
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MedianFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t queue_size = this->window_.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        this->window_.partition(queue_size / 2 + 1);
+        median = this->window_.lower_max();
+      } else {
+        this->window_.partition(queue_size / 2);
+        median = (this->window_.upper_min() + this->window_.lower_max()) / 2.0f;
       }
     }
 
@@ -89,38 +179,25 @@ optional<float> SkipInitialFilter::new_value(float value) {
 
 // QuantileFilter
 QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {}
 void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t queue_size = this->window_.size();
+    if (queue_size) {
+      // A quantile of 0 selects the minimum
+      size_t position = std::max(ceilf(queue_size * this->quantile_), 1.0f) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
+      this->window_.partition(position + 1);
+      result = this->window_.lower_max();
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
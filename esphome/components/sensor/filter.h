@@ -44,6 +44,52 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** Sliding window of values that keeps one order statistic available in O(1).
+ *
+ * The values are stored in a ring buffer. The non-NaN values of the window are split over a max-heap holding the
+ * lowest values and a min-heap holding the rest; every slot remembers its heap position, so evicting the oldest value
+ * and adding a new one takes O(log n). No memory is allocated after the window size is set.
+ */
+class OrderStatisticWindow {
+ public:
+  explicit OrderStatisticWindow(size_t window_size) { this->set_window_size(window_size); }
+
+  /// Change the window size, keeping the newest values. A size of 0 is treated as 1.
+  void set_window_size(size_t window_size);
+  /// Add a value, evicting the oldest one if the window is full. NaN values take up a slot but are not counted.
+  void push(float value);
+  /// Number of non-NaN values in the window.
+  size_t size() const { return this->lower_.size() + this->upper_.size(); }
+  /// Move values between the heaps so that the lowest count values are in the lower heap, count <= size().
+  void partition(size_t count);
+  /// The largest of the partitioned lowest values, the lower heap must not be empty.
+  float lower_max() const { return this->values_[this->lower_.front()]; }
+  /// The smallest of the remaining values, the upper heap must not be empty.
+  float upper_min() const { return this->values_[this->upper_.front()]; }
+
+ protected:
+  static constexpr uint32_t UPPER_HEAP = 1UL << 31;
+  static constexpr uint32_t NOT_IN_HEAP = UINT32_MAX;
+
+  /// Whether slot a belongs closer to the root of the heap than slot b.
+  bool before_(bool upper, uint32_t a, uint32_t b) const {
+    return upper ? this->values_[a] < this->values_[b] : this->values_[a] > this->values_[b];
+  }
+  void heap_push_(bool upper, uint32_t slot);
+  void heap_remove_(bool upper, size_t pos);
+  void heap_place_(bool upper, size_t pos, uint32_t slot);
+  void sift_up_(bool upper, size_t pos);
+  void sift_down_(bool upper, size_t pos);
+
+  std::vector<float> values_;
+  /// Heap position of every slot, UPPER_HEAP is set for the upper heap.
+  std::vector<uint32_t> slot_pos_;
+  std::vector<uint32_t> lower_;
+  std::vector<uint32_t> upper_;
+  size_t head_{0};
+  size_t count_{0};
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -68,10 +114,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  OrderStatisticWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -97,10 +142,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  OrderStatisticWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
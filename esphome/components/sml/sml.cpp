@@ -25,40 +25,45 @@ char Sml::check_start_end_bytes_(uint8_t byte) {
 }
 
 void Sml::loop() {
-  while (available()) {
-    const char c = read();
-
-    if (this->record_)
-      this->sml_data_.emplace_back(c);
-
-    switch (this->check_start_end_bytes_(c)) {
-      case START_BYTES_DETECTED: {
-        this->record_ = true;
-        this->sml_data_.clear();
-        // add start sequence (for callbacks)
-        this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
-        break;
-      };
-      case END_BYTES_DETECTED: {
-        if (this->record_) {
-          this->record_ = false;
-
-          bool valid = check_sml_data(this->sml_data_);
-
-          // call callbacks
-          this->data_callbacks_.call(this->sml_data_, valid);
-
-          if (!valid)
-            break;
-
-          // remove start/end sequence
-          this->sml_data_.erase(this->sml_data_.begin(), this->sml_data_.begin() + START_SEQ.size());
-          this->sml_data_.resize(this->sml_data_.size() - 8);
-          this->process_sml_file_(this->sml_data_);
-        }
-        break;
+  uint8_t buf[64];
+  size_t len;
+  while ((len = this->read_available(buf, sizeof(buf))) > 0) {
+    // while recording, the bytes of buf from record_start on are appended to sml_data_ at once
+    size_t record_start = 0;
+    for (size_t i = 0; i < len; i++) {
+      switch (this->check_start_end_bytes_(buf[i])) {
+        case START_BYTES_DETECTED: {
+          this->record_ = true;
+          this->sml_data_.clear();
+          // add start sequence (for callbacks)
+          this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
+          record_start = i + 1;
+          break;
+        };
+        case END_BYTES_DETECTED: {
+          if (this->record_) {
+            this->record_ = false;
+            this->sml_data_.insert(this->sml_data_.end(), buf + record_start, buf + i + 1);
+
+            bool valid = check_sml_data(this->sml_data_);
+
+            // call callbacks
+            this->data_callbacks_.call(this->sml_data_, valid);
+
+            if (!valid)
+              break;
+
+            // remove start/end sequence
+            this->sml_data_.erase(this->sml_data_.begin(), this->sml_data_.begin() + START_SEQ.size());
+            this->sml_data_.resize(this->sml_data_.size() - 8);
+            this->process_sml_file_(this->sml_data_);
+          }
+          break;
+        };
       };
-    };
+    }
+    if (this->record_)
+      this->sml_data_.insert(this->sml_data_.end(), buf + record_start, buf + len);
   }
 }
 
@@ -1,5 +1,6 @@
 #include "socket.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 
 #ifdef USE_SOCKET_IMPL_BSD_SOCKETS
@@ -40,7 +41,12 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class BSDSocketImpl : public Socket {
  public:
-  BSDSocketImpl(int fd) : fd_(fd) {}
+  BSDSocketImpl(int fd, bool monitor_loop = false) : fd_(fd) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (monitor_loop)
+      this->loop_monitored_ = App.register_socket_fd(fd);
+#endif
+  }
   ~BSDSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -50,10 +56,15 @@ class BSDSocketImpl : public Socket {
     int fd = ::accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
-    return make_unique<BSDSocketImpl>(fd);
+    return make_unique<BSDSocketImpl>(fd, this->loop_monitored_);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override { return ::connect(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_)
+      App.unregister_socket_fd(this->fd_);
+#endif
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
@@ -125,9 +136,15 @@ class BSDSocketImpl : public Socket {
     return 0;
   }
 
+  int get_fd() const override { return this->fd_; }
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  bool ready() const override { return !this->loop_monitored_ || App.is_socket_ready(this->fd_); }
+#endif
+
  protected:
   int fd_;
   bool closed_ = false;
+  bool loop_monitored_ = false;
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -137,6 +154,13 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{new BSDSocketImpl(ret)};
 }
 
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  int ret = ::socket(domain, type, protocol);
+  if (ret == -1)
+    return nullptr;
+  return std::unique_ptr<Socket>{new BSDSocketImpl(ret, true)};
+}
+
 }  // namespace socket
 }  // namespace esphome
 
@@ -143,6 +143,11 @@ class LWIPRawImpl : public Socket {
     pcb_ = nullptr;
     return 0;
   }
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override {
+    // outgoing connections are not supported by the raw TCP implementation yet
+    errno = EOPNOTSUPP;
+    return -1;
+  }
   int shutdown(int how) override {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
@@ -606,6 +611,11 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{sock};
 }
 
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  // The raw TCP API is callback based, there are no file descriptors to wait for
+  return socket(domain, type, protocol);
+}
+
 }  // namespace socket
 }  // namespace esphome
 
@@ -19,9 +19,8 @@ class Socket {
   virtual std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual int bind(const struct sockaddr *addr, socklen_t addrlen) = 0;
   virtual int close() = 0;
-  // not supported yet:
-  // virtual int connect(const std::string &address) = 0;
-  // virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
+  /// Start connecting to a remote address, non-blocking sockets return -1 with errno EINPROGRESS.
+  virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
   virtual int shutdown(int how) = 0;
 
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
@@ -42,6 +41,15 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /// File descriptor of this socket, or -1 if the implementation isn't file descriptor based.
+  virtual int get_fd() const { return -1; }
+  /** Whether the last main loop wakeup found this socket readable.
+   *
+   * Only loop monitored sockets (see socket_loop_monitored()) are tracked, for all others and on platforms without
+   * select() support this always returns true.
+   */
+  virtual bool ready() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -50,6 +58,17 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
 std::unique_ptr<Socket> socket_ip(int type, int protocol);
 
+/** Create a socket that wakes the main loop when it becomes readable.
+ *
+ * The main loop waits for these sockets in select() while idle, so incoming data is handled right away instead of
+ * after the rest of the loop interval. Sockets accepted from a monitored listening socket are monitored as well.
+ * On platforms without select() support this is the same as socket().
+ */
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol);
+
+/// Create a loop monitored socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
+std::unique_ptr<Socket> socket_ip_loop_monitored(int type, int protocol);
+
 /// Set a sockaddr to the specified address and port for the IP version used by socket_ip().
 socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address, uint16_t port);
 
@@ -118,6 +118,7 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  this->init_dirty_tiles_();
 }
 
 void ST7789V::dump_config() {
@@ -149,35 +150,36 @@ void ST7789V::update() {
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  this->flush_dirty_regions_([this](int x1, int y1, int x2, int y2) { this->write_region_(x1, y1, x2, y2); });
+}
 
+void ST7789V::write_region_(int x1, int y1, int x2, int y2) {
   this->enable();
 
   // set column(x) address
   this->dc_pin_->digital_write(false);
   this->write_byte(ST7789_CASET);
   this->dc_pin_->digital_write(true);
-  this->write_addr_(x1, x2);
+  this->write_addr_(this->offset_height_ + x1, this->offset_height_ + x2);
   // set page(y) address
   this->dc_pin_->digital_write(false);
   this->write_byte(ST7789_RASET);
   this->dc_pin_->digital_write(true);
-  this->write_addr_(y1, y2);
+  this->write_addr_(this->offset_width_ + y1, this->offset_width_ + y2);
   // write display memory
   this->dc_pin_->digital_write(false);
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const int width = x2 - x1 + 1;
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int y = y1; y <= y2; y++) {
+      const uint8_t *line = this->buffer_ + y * this->get_width_internal() + x1;
+      for (int index = 0; index < width; ++index) {
         auto color = display::ColorUtil::color_to_565(
-            display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
+            display::ColorUtil::to_color(line[index], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
@@ -189,8 +191,12 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (width == this->get_width_internal()) {
+    // whole rows are contiguous in the buffer
+    this->write_array(this->buffer_ + y1 * width * 2, (y2 - y1 + 1) * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int y = y1; y <= y2; y++)
+      this->write_array(this->buffer_ + (y * this->get_width_internal() + x1) * 2, width * 2);
   }
 
   this->disable();
@@ -293,16 +299,22 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
+  bool updated;
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    updated = this->buffer_[pos] != color332;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    updated = this->buffer_[pos] != ((color565 >> 8) & 0xff) || this->buffer_[pos + 1] != (color565 & 0xff);
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  // only the tiles that changed are sent by write_display_data()
+  if (updated)
+    this->mark_dirty_(x, y);
 }
 
 }  // namespace st7789v
@@ -156,6 +156,8 @@ class ST7789V : public display::DisplayBuffer,
   void write_data_(uint8_t value);
   void write_addr_(uint16_t addr1, uint16_t addr2);
   void write_color_(uint16_t color, uint16_t size);
+  /// Send a region of the buffer, both corners included.
+  void write_region_(int x1, int y1, int x2, int y2);
 
   int get_height_internal() override { return this->height_; }
   int get_width_internal() override { return this->width_; }
@@ -5,6 +5,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 
+#include <algorithm>
+
 #ifdef USE_WIFI
 #include "esphome/components/wifi/wifi_component.h"
 #endif
@@ -29,10 +31,10 @@ void Tuya::setup() {
 }
 
 void Tuya::loop() {
-  while (this->available()) {
-    uint8_t c;
-    this->read_byte(&c);
-    this->handle_char_(c);
+  uint8_t buf[64];
+  size_t len;
+  while ((len = this->read_available(buf, sizeof(buf))) > 0) {
+    this->handle_data_(buf, len);
   }
   process_command_queue_();
 }
@@ -130,12 +132,22 @@ bool Tuya::validate_message_() {
   return false;
 }
 
-void Tuya::handle_char_(uint8_t c) {
-  this->rx_message_.push_back(c);
-  if (!this->validate_message_()) {
-    this->rx_message_.clear();
-  } else {
-    this->last_rx_char_timestamp_ = millis();
+void Tuya::handle_data_(const uint8_t *data, size_t len) {
+  while (len > 0) {
+    // The header is validated byte by byte, the data and checksum are appended at once and validated when complete
+    size_t count = 1;
+    if (this->rx_message_.size() >= 6) {
+      size_t length = (uint16_t(this->rx_message_[4]) << 8) | (uint16_t(this->rx_message_[5]));
+      count = std::min(len, 7 + length - this->rx_message_.size());
+    }
+    this->rx_message_.insert(this->rx_message_.end(), data, data + count);
+    data += count;
+    len -= count;
+    if (!this->validate_message_()) {
+      this->rx_message_.clear();
+    } else {
+      this->last_rx_char_timestamp_ = millis();
+    }
   }
 }
 
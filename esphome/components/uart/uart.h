@@ -30,6 +30,10 @@ class UARTDevice {
   bool peek_byte(uint8_t *data) { return this->parent_->peek_byte(data); }
 
   bool read_array(uint8_t *data, size_t len) { return this->parent_->read_array(data, len); }
+  size_t read_available(uint8_t *data, size_t len) { return this->parent_->read_available(data, len); }
+  template<size_t N> size_t read_available(std::array<uint8_t, N> &data) {
+    return this->parent_->read_available(data.data(), N);
+  }
   template<size_t N> optional<std::array<uint8_t, N>> read_array() {  // NOLINT
     std::array<uint8_t, N> res;
     if (!this->read_array(res.data(), N)) {
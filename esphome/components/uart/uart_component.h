@@ -67,6 +67,12 @@ class UARTComponent {
   // @return True if the specified number of bytes were successfully read, false otherwise.
   virtual bool read_array(uint8_t *data, size_t len) = 0;
 
+  // Reads the bytes that have already been received, up to len, without waiting for more.
+  // @param data Pointer to the array where the read data will be stored.
+  // @param len Maximum number of bytes to read.
+  // @return Number of bytes read, 0 if nothing has been received.
+  virtual size_t read_available(uint8_t *data, size_t len);
+
   // Pure virtual method to return the number of bytes available for reading.
   // @return Number of available bytes.
   virtual int available() = 0;
@@ -221,6 +221,28 @@ bool IDFUARTComponent::read_array(uint8_t *data, size_t len) {
   return true;
 }
 
+size_t IDFUARTComponent::read_available(uint8_t *data, size_t len) {
+  if (len == 0)
+    return 0;
+  size_t read = 0;
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  if (this->has_peek_) {
+    data[read++] = this->peek_byte_;
+    this->has_peek_ = false;
+  }
+  // the driver already keeps received bytes in its ring buffer, take what is there without waiting
+  int received = uart_read_bytes(this->uart_num_, data + read, len - read, 0);
+  if (received > 0)
+    read += received;
+  xSemaphoreGive(this->lock_);
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < read; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+  return read;
+}
+
 int IDFUARTComponent::available() {
   size_t available;
 
@@ -9,13 +9,14 @@
 #error This HostUartComponent implementation is not supported on this host OS
 #endif
 
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <termios.h>
-#include <sys/ioctl.h>
+#include <sys/uio.h>
 
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -123,6 +124,7 @@ void HostUartComponent::setup() {
     return;
   }
   fcntl(this->file_descriptor_, F_SETFL, 0);
+  this->rx_buffer_.resize(std::max<size_t>(this->rx_buffer_size_, 1));
   struct termios options;
   tcgetattr(this->file_descriptor_, &options);
   options.c_cflag &= ~CRTSCTS;
@@ -136,6 +138,9 @@ void HostUartComponent::setup() {
   options.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL);
   options.c_oflag &= ~OPOST;
   options.c_oflag &= ~ONLCR;
+  // read() returns immediately with what has been received so far
+  options.c_cc[VMIN] = 0;
+  options.c_cc[VTIME] = 0;
   // Set data bits
   options.c_cflag &= ~CSIZE;  // Mask the character size bits
   switch (this->data_bits_) {
@@ -220,17 +225,10 @@ bool HostUartComponent::peek_byte(uint8_t *data) {
   if (this->file_descriptor_ == -1) {
     return false;
   }
-  if (!this->has_peek_) {
-    if (!this->check_read_timeout_()) {
-      return false;
-    }
-    if (::read(this->file_descriptor_, &this->peek_byte_, 1) != 1) {
-      this->update_error_(strerror(errno));
-      return false;
-    }
-    this->has_peek_ = true;
+  if (!this->check_read_timeout_()) {
+    return false;
   }
-  *data = this->peek_byte_;
+  *data = this->rx_buffer_[this->rx_head_];
   return true;
 }
 
@@ -238,46 +236,77 @@ bool HostUartComponent::read_array(uint8_t *data, size_t len) {
   if ((this->file_descriptor_ == -1) || (len == 0)) {
     return false;
   }
-  if (!this->check_read_timeout_(len))
-    return false;
-  uint8_t *data_ptr = data;
-  size_t length_to_read = len;
-  if (this->has_peek_) {
-    length_to_read--;
-    *data_ptr = this->peek_byte_;
-    data_ptr++;
-    this->has_peek_ = false;
-  }
-  if (length_to_read > 0) {
-    int sz = ::read(this->file_descriptor_, data_ptr, length_to_read);
-    if (sz == -1) {
-      this->update_error_(strerror(errno));
+  // Reads longer than the RX buffer are drained through it in several passes
+  while (len > 0) {
+    const size_t chunk = std::min(len, this->rx_buffer_.size());
+    if (!this->check_read_timeout_(chunk))
       return false;
-    }
-  }
-#ifdef USE_UART_DEBUGGER
-  for (size_t i = 0; i < len; i++) {
-    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+    this->pop_rx_buffer_(data, chunk);
+    data += chunk;
+    len -= chunk;
   }
-#endif
   return true;
 }
 
-int HostUartComponent::available() {
+size_t HostUartComponent::read_available(uint8_t *data, size_t len) {
   if (this->file_descriptor_ == -1) {
     return 0;
   }
-  int available;
-  int res = ioctl(this->file_descriptor_, FIONREAD, &available);
-  if (res == -1) {
-    this->update_error_(strerror(errno));
+  if (this->rx_count_ < len)
+    this->fill_rx_buffer_();
+  len = std::min(len, this->rx_count_);
+  this->pop_rx_buffer_(data, len);
+  return len;
+}
+
+int HostUartComponent::available() {
+  if (this->file_descriptor_ == -1) {
     return 0;
   }
-  if (this->has_peek_)
-    available++;
-  return available;
+  this->fill_rx_buffer_();
+  return this->rx_count_;
 };
 
+void HostUartComponent::fill_rx_buffer_() {
+  const size_t size = this->rx_buffer_.size();
+  if (this->rx_count_ == size)
+    return;
+  // the free space wraps around the end of the buffer in at most two parts
+  const size_t tail = (this->rx_head_ + this->rx_count_) % size;
+  struct iovec parts[2];
+  int count = 1;
+  parts[0].iov_base = &this->rx_buffer_[tail];
+  if (tail >= this->rx_head_) {
+    parts[0].iov_len = size - tail;
+    parts[1].iov_base = &this->rx_buffer_[0];
+    parts[1].iov_len = this->rx_head_;
+    count = this->rx_head_ > 0 ? 2 : 1;
+  } else {
+    parts[0].iov_len = this->rx_head_ - tail;
+  }
+  ssize_t received = ::readv(this->file_descriptor_, parts, count);
+  if (received == -1) {
+    if (errno != EAGAIN && errno != EINTR)
+      this->update_error_(strerror(errno));
+    return;
+  }
+  this->rx_count_ += received;
+}
+
+void HostUartComponent::pop_rx_buffer_(uint8_t *data, size_t len) {
+  const size_t size = this->rx_buffer_.size();
+  const size_t first = std::min(len, size - this->rx_head_);
+  memcpy(data, &this->rx_buffer_[this->rx_head_], first);
+  memcpy(data + first, &this->rx_buffer_[0], len - first);
+  this->rx_head_ = (this->rx_head_ + len) % size;
+  this->rx_count_ -= len;
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+}
+
 void HostUartComponent::flush() {
   if (this->file_descriptor_ == -1) {
     return;
@@ -2,6 +2,7 @@
 
 #ifdef USE_HOST
 
+#include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 #include "uart_component.h"
@@ -18,6 +19,7 @@ class HostUartComponent : public UARTComponent, public Component {
   void write_array(const uint8_t *data, size_t len) override;
   bool peek_byte(uint8_t *data) override;
   bool read_array(uint8_t *data, size_t len) override;
+  size_t read_available(uint8_t *data, size_t len) override;
   int available() override;
   void flush() override;
   void set_name(std::string port_name) { port_name_ = port_name; };
@@ -25,11 +27,17 @@ class HostUartComponent : public UARTComponent, public Component {
  protected:
   void update_error_(const std::string &error);
   void check_logger_conflict() override {}
+  /// Move whatever the port received into the ring buffer, with a single read() call.
+  void fill_rx_buffer_();
+  /// Copy len buffered bytes out of the ring buffer, len must not exceed rx_count_.
+  void pop_rx_buffer_(uint8_t *data, size_t len);
   std::string port_name_;
   std::string first_error_{""};
   int file_descriptor_ = -1;
-  bool has_peek_{false};
-  uint8_t peek_byte_;
+  /// Ring buffer of received bytes, rx_count_ bytes starting at rx_head_.
+  std::vector<uint8_t> rx_buffer_;
+  size_t rx_head_{0};
+  size_t rx_count_{0};
 };
 
 }  // namespace uart
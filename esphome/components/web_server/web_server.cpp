@@ -13,6 +13,7 @@
 #endif
 
 #include <cstdlib>
+#include <cstring>
 
 #ifdef USE_LIGHT
 #include "esphome/components/light/light_json_schema.h"
@@ -26,6 +27,10 @@
 #include "esphome/components/climate/climate.h"
 #endif
 
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
+
 #ifdef USE_WEBSERVER_LOCAL
 #if USE_WEBSERVER_VERSION == 2
 #include "server_index_v2.h"
@@ -199,69 +204,115 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 }
 #endif
 
-#define set_json_id(root, obj, sensor, start_config) \
-  (root)["id"] = sensor; \
-  if (((start_config) == DETAIL_ALL)) { \
-    (root)["name"] = (obj)->get_name(); \
-    (root)["icon"] = (obj)->get_icon(); \
-    (root)["entity_category"] = (obj)->get_entity_category(); \
-    if ((obj)->is_disabled_by_default()) \
-      (root)["is_disabled_by_default"] = (obj)->is_disabled_by_default(); \
+#ifdef USE_PROFILER
+void WebServer::handle_profile_request(AsyncWebServerRequest *request) {
+  // This runs on the task of the web server, the profiler is only read through a copy taken under its lock
+  const profiler::ProfileReport report = profiler::global_profiler->get_report();
+  std::string data = json::build_json([&report](JsonObject root) {
+    root["window_ms"] = report.window_ms;
+    JsonObject loop_time = root.createNestedObject("loop_time");
+    loop_time["max_us"] = report.loop_time.max_us;
+    loop_time["p99_us"] = report.loop_time.p99_us;
+    JsonObject loop_jitter = root.createNestedObject("loop_jitter");
+    loop_jitter["max_us"] = report.loop_jitter.max_us;
+    loop_jitter["p99_us"] = report.loop_jitter.p99_us;
+    JsonArray components = root.createNestedArray("components");
+    for (const auto &profile : report.components) {
+      JsonObject component = components.createNestedObject();
+      component["source"] = profile.source;
+      JsonObject loop = component.createNestedObject("loop");
+      loop["count"] = profile.loop.count;
+      loop["total_us"] = profile.loop.total_us;
+      loop["max_us"] = profile.loop.max_us;
+      loop["p99_us"] = profile.loop.p99_us;
+      JsonObject scheduler = component.createNestedObject("scheduler");
+      scheduler["count"] = profile.scheduler.count;
+      scheduler["total_us"] = profile.scheduler.total_us;
+      scheduler["max_us"] = profile.scheduler.max_us;
+      scheduler["p99_us"] = profile.scheduler.p99_us;
+    }
+  });
+  request->send(200, "application/json", data.c_str());
+}
+#endif
+
+static void set_json_id(json::JsonWriter &json, EntityBase *obj, const char *prefix, JsonDetail start_config) {
+  const char *object_id = obj->get_static_object_id();
+  if (object_id != nullptr) {
+    json.add_concat("id", prefix, object_id);
+  } else {
+    json.add_concat("id", prefix, obj->get_object_id().c_str());
   }
+  if (start_config == DETAIL_ALL) {
+    json.add("name", obj->get_name());
+    json.add("icon", obj->get_icon());
+    json.add("entity_category", obj->get_entity_category());
+    if (obj->is_disabled_by_default())
+      json.add("is_disabled_by_default", obj->is_disabled_by_default());
+  }
+}
 
-#define set_json_value(root, obj, sensor, value, start_config) \
-  set_json_id((root), (obj), sensor, start_config); \
-  (root)["value"] = value;
+template<typename V>
+static void set_json_value(json::JsonWriter &json, EntityBase *obj, const char *prefix, const V &value,
+                           JsonDetail start_config) {
+  set_json_id(json, obj, prefix, start_config);
+  json.add("value", value);
+}
 
-#define set_json_icon_state_value(root, obj, sensor, state, value, start_config) \
-  set_json_value(root, obj, sensor, value, start_config); \
-  (root)["state"] = state;
+template<typename S, typename V>
+static void set_json_icon_state_value(json::JsonWriter &json, EntityBase *obj, const char *prefix, const S &state,
+                                      const V &value, JsonDetail start_config) {
+  set_json_value(json, obj, prefix, value, start_config);
+  json.add("state", state);
+}
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->sensor_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  sensor::Sensor *obj = App.get_sensor_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->sensor_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->sensor_json(json, obj, obj->state, detail));
       return;
     }
   }
   request->send(404);
 }
-std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    std::string state;
-    if (std::isnan(value)) {
-      state = "NA";
-    } else {
-      state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
-      if (!obj->get_unit_of_measurement().empty())
-        state += " " + obj->get_unit_of_measurement();
-    }
-    set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::sensor_json(json::JsonWriter &json, sensor::Sensor *obj, float value, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  char state[64];
+  if (std::isnan(value)) {
+    strcpy(state, "NA");
+  } else {
+    size_t len = value_accuracy_to_buf(state, sizeof(state), value, obj->get_accuracy_decimals());
+    const std::string unit = obj->get_unit_of_measurement();
+    if (!unit.empty())
+      snprintf(state + len, sizeof(state) - len, " %s", unit.c_str());
+  }
+  set_json_icon_state_value(json, obj, "sensor-", state, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
-      if (!obj->get_unit_of_measurement().empty())
-        root["uom"] = obj->get_unit_of_measurement();
     }
-  });
+    if (!obj->get_unit_of_measurement().empty())
+      json.add("uom", obj->get_unit_of_measurement());
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -269,38 +320,39 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->text_sensor_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  text_sensor::TextSensor *obj = App.get_text_sensor_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->text_sensor_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->text_sensor_json(json, obj, obj->state, detail));
       return;
     }
   }
   request->send(404);
 }
-std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
+const char *WebServer::text_sensor_json(json::JsonWriter &json, text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "text_sensor-", value, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -308,21 +360,19 @@ std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std:
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->switch_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  switch_::Switch *obj = App.get_switch_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->switch_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->switch_json(json, obj, obj->state, detail));
     } else if (match.method == "toggle") {
       this->schedule_([obj]() { obj->toggle(); });
       request->send(200);
@@ -339,35 +389,36 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
-    if (start_config == DETAIL_ALL) {
-      root["assumed_state"] = obj->assumed_state();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::switch_json(json::JsonWriter &json, switch_::Switch *obj, bool value, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "switch-", value ? "ON" : "OFF", value, start_config);
+  if (start_config == DETAIL_ALL) {
+    json.add("assumed_state", obj->assumed_state());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  button::Button *obj = App.get_button_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->button_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->button_json(json, obj, detail));
     } else if (match.method == "press") {
       this->schedule_([obj]() { obj->press(); });
       request->send(200);
@@ -379,18 +430,20 @@ void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "button-" + obj->get_object_id(), start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::button_json(json::JsonWriter &json, button::Button *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "button-", start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -398,38 +451,40 @@ std::string WebServer::button_json(button::Button *obj, JsonDetail start_config)
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->binary_sensor_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  binary_sensor::BinarySensor *obj = App.get_binary_sensor_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->binary_sensor_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->binary_sensor_json(json, obj, obj->state, detail));
       return;
     }
   }
   request->send(404);
 }
-std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
-                              start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::binary_sensor_json(json::JsonWriter &json, binary_sensor::BinarySensor *obj, bool value,
+                                          JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "binary_sensor-", value ? "ON" : "OFF", value,
+                            start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -437,21 +492,19 @@ std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool
 void WebServer::on_fan_update(fan::Fan *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->fan_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  fan::Fan *obj = App.get_fan_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->fan_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->fan_json(json, obj, detail));
     } else if (match.method == "toggle") {
       this->schedule_([obj]() { obj->toggle().perform(); });
       request->send(200);
@@ -494,26 +547,28 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
   }
   request->send(404);
 }
-std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
-                              start_config);
-    const auto traits = obj->get_traits();
-    if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
-      root["speed_count"] = traits.supported_speed_count();
-    }
-    if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::fan_json(json::JsonWriter &json, fan::Fan *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "fan-", obj->state ? "ON" : "OFF", obj->state,
+                            start_config);
+  const auto traits = obj->get_traits();
+  if (traits.supports_speed()) {
+    json.add("speed_level", obj->speed);
+    json.add("speed_count", traits.supported_speed_count());
+  }
+  if (obj->get_traits().supports_oscillation())
+    json.add("oscillation", obj->oscillating);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -521,21 +576,19 @@ std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
 void WebServer::on_light_update(light::LightState *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->light_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  light::LightState *obj = App.get_light_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->light_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->light_json(json, obj, detail));
     } else if (match.method == "toggle") {
       this->schedule_([obj]() { obj->toggle().perform(); });
       request->send(200);
@@ -613,26 +666,31 @@ void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
-
-    light::LightJSONSchema::dump_json(*obj, root);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("effects");
-      opt.add("None");
-      for (auto const &option : obj->get_effects()) {
-        opt.add(option->get_name());
-      }
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::light_json(json::JsonWriter &json, light::LightState *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "light-", start_config);
+  // The schema only contains the state when the color mode is known, members can't be overwritten later
+  if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
+    json.add("state", obj->remote_values.is_on() ? "ON" : "OFF");
+
+  light::LightJSONSchema::dump_json(*obj, json);
+  if (start_config == DETAIL_ALL) {
+    json.begin_array("effects");
+    json.add("None");
+    for (auto const &option : obj->get_effects()) {
+      json.add(option->get_name());
+    }
+    json.end_array();
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -640,21 +698,19 @@ std::string WebServer::light_json(light::LightState *obj, JsonDetail start_confi
 void WebServer::on_cover_update(cover::Cover *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->cover_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  cover::Cover *obj = App.get_cover_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->cover_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->cover_json(json, obj, detail));
       return;
     }
 
@@ -698,25 +754,27 @@ void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
-                              obj->position, start_config);
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
-
-    if (obj->get_traits().get_supports_position())
-      root["position"] = obj->position;
-    if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::cover_json(json::JsonWriter &json, cover::Cover *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "cover-", obj->is_fully_closed() ? "CLOSED" : "OPEN",
+                            obj->position, start_config);
+  json.add("current_operation", cover::cover_operation_to_str(obj->current_operation));
+
+  if (obj->get_traits().get_supports_position())
+    json.add("position", obj->position);
+  if (obj->get_traits().get_supports_tilt())
+    json.add("tilt", obj->tilt);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -724,21 +782,19 @@ std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
 void WebServer::on_number_update(number::Number *obj, float state) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->number_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = App.get_number_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->number_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->number_json(json, obj, obj->state, detail));
       return;
     }
     if (match.method != "set") {
@@ -760,37 +816,41 @@ void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 
-std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
-    if (start_config == DETAIL_ALL) {
-      root["min_value"] =
-          value_accuracy_to_string(obj->traits.get_min_value(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["max_value"] =
-          value_accuracy_to_string(obj->traits.get_max_value(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["step"] =
-          value_accuracy_to_string(obj->traits.get_step(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["mode"] = (int) obj->traits.get_mode();
-      if (!obj->traits.get_unit_of_measurement().empty())
-        root["uom"] = obj->traits.get_unit_of_measurement();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::number_json(json::JsonWriter &json, number::Number *obj, float value, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "number-", start_config);
+  if (start_config == DETAIL_ALL) {
+    json.add("min_value",
+             value_accuracy_to_string(obj->traits.get_min_value(), step_to_accuracy_decimals(obj->traits.get_step())));
+    json.add("max_value",
+             value_accuracy_to_string(obj->traits.get_max_value(), step_to_accuracy_decimals(obj->traits.get_step())));
+    json.add("step",
+             value_accuracy_to_string(obj->traits.get_step(), step_to_accuracy_decimals(obj->traits.get_step())));
+    json.add("mode", (int) obj->traits.get_mode());
+    if (!obj->traits.get_unit_of_measurement().empty())
+      json.add("uom", obj->traits.get_unit_of_measurement());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-    if (std::isnan(value)) {
-      root["value"] = "\"NaN\"";
-      root["state"] = "NA";
-    } else {
-      root["value"] = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
-      std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
-      if (!obj->traits.get_unit_of_measurement().empty())
-        state += " " + obj->traits.get_unit_of_measurement();
-      root["state"] = state;
-    }
-  });
+  }
+  if (std::isnan(value)) {
+    json.add("value", "\"NaN\"");
+    json.add("state", "NA");
+  } else {
+    char state[64];
+    size_t len = value_accuracy_to_buf(state, sizeof(state), value, step_to_accuracy_decimals(obj->traits.get_step()));
+    json.add("value", StringRef(state, len));
+    const std::string unit = obj->traits.get_unit_of_measurement();
+    if (!unit.empty())
+      snprintf(state + len, sizeof(state) - len, " %s", unit.c_str());
+    json.add("state", state);
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -798,20 +858,19 @@ std::string WebServer::number_json(number::Number *obj, float value, JsonDetail
 void WebServer::on_date_update(datetime::DateEntity *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->date_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->date_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_dates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = App.get_date_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->date_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->date_json(json, obj, detail));
       return;
     }
     if (match.method != "set") {
@@ -838,21 +897,23 @@ void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 
-std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "date-" + obj->get_object_id(), start_config);
-    std::string value = str_sprintf("%d-%02d-%02d", obj->year, obj->month, obj->day);
-    root["value"] = value;
-    root["state"] = value;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::date_json(json::JsonWriter &json, datetime::DateEntity *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "date-", start_config);
+  std::string value = str_sprintf("%d-%02d-%02d", obj->year, obj->month, obj->day);
+  json.add("value", value);
+  json.add("state", value);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif  // USE_DATETIME_DATE
 
@@ -860,20 +921,19 @@ std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_con
 void WebServer::on_time_update(datetime::TimeEntity *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->time_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->time_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_times()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = App.get_time_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->time_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->time_json(json, obj, detail));
       return;
     }
     if (match.method != "set") {
@@ -899,21 +959,23 @@ void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMat
   }
   request->send(404);
 }
-std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "time-" + obj->get_object_id(), start_config);
-    std::string value = str_sprintf("%02d:%02d:%02d", obj->hour, obj->minute, obj->second);
-    root["value"] = value;
-    root["state"] = value;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::time_json(json::JsonWriter &json, datetime::TimeEntity *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "time-", start_config);
+  std::string value = str_sprintf("%02d:%02d:%02d", obj->hour, obj->minute, obj->second);
+  json.add("value", value);
+  json.add("state", value);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif  // USE_DATETIME_TIME
 
@@ -921,20 +983,19 @@ std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_con
 void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->datetime_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->datetime_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_datetimes()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = App.get_datetime_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->datetime_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->datetime_json(json, obj, detail));
       return;
     }
     if (match.method != "set") {
@@ -960,22 +1021,24 @@ void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const Ur
   }
   request->send(404);
 }
-std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "datetime-" + obj->get_object_id(), start_config);
-    std::string value = str_sprintf("%d-%02d-%02d %02d:%02d:%02d", obj->year, obj->month, obj->day, obj->hour,
-                                    obj->minute, obj->second);
-    root["value"] = value;
-    root["state"] = value;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::datetime_json(json::JsonWriter &json, datetime::DateTimeEntity *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "datetime-", start_config);
+  std::string value = str_sprintf("%d-%02d-%02d %02d:%02d:%02d", obj->year, obj->month, obj->day, obj->hour,
+                                  obj->minute, obj->second);
+  json.add("value", value);
+  json.add("state", value);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif  // USE_DATETIME_DATETIME
 
@@ -983,21 +1046,19 @@ std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail s
 void WebServer::on_text_update(text::Text *obj, const std::string &state) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->text_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_texts()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = App.get_text_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->text_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->text_json(json, obj, obj->state, detail));
       return;
     }
     if (match.method != "set") {
@@ -1018,28 +1079,31 @@ void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 
-std::string WebServer::text_json(text::Text *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "text-" + obj->get_object_id(), start_config);
-    root["min_length"] = obj->traits.get_min_length();
-    root["max_length"] = obj->traits.get_max_length();
-    root["pattern"] = obj->traits.get_pattern();
-    if (obj->traits.get_mode() == text::TextMode::TEXT_MODE_PASSWORD) {
-      root["state"] = "********";
-    } else {
-      root["state"] = value;
-    }
-    root["value"] = value;
-    if (start_config == DETAIL_ALL) {
-      root["mode"] = (int) obj->traits.get_mode();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::text_json(json::JsonWriter &json, text::Text *obj, const std::string &value,
+                                 JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "text-", start_config);
+  json.add("min_length", obj->traits.get_min_length());
+  json.add("max_length", obj->traits.get_max_length());
+  json.add("pattern", obj->traits.get_pattern());
+  if (obj->traits.get_mode() == text::TextMode::TEXT_MODE_PASSWORD) {
+    json.add("state", "********");
+  } else {
+    json.add("state", value);
+  }
+  json.add("value", value);
+  if (start_config == DETAIL_ALL) {
+    json.add("mode", (int) obj->traits.get_mode());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1047,21 +1111,19 @@ std::string WebServer::text_json(text::Text *obj, const std::string &value, Json
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->select_json(this->event_json_, obj, state, DETAIL_STATE), "state");
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = App.get_select_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->select_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->select_json(json, obj, obj->state, detail));
       return;
     }
 
@@ -1083,22 +1145,26 @@ void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("option");
-      for (auto &option : obj->traits.get_options()) {
-        opt.add(option);
-      }
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::select_json(json::JsonWriter &json, select::Select *obj, const std::string &value,
+                                   JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "select-", value, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    json.begin_array("option");
+    for (auto &option : obj->traits.get_options()) {
+      json.add(option);
+    }
+    json.end_array();
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1109,21 +1175,19 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 void WebServer::on_climate_update(climate::Climate *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->climate_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = App.get_climate_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->climate_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->climate_json(json, obj, detail));
       return;
     }
     if (match.method != "set") {
@@ -1172,97 +1236,106 @@ void WebServer::handle_climate_request(AsyncWebServerRequest *request, const Url
   }
   request->send(404);
 }
-std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
-    const auto traits = obj->get_traits();
-    int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
-    int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
-    char buf[16];
-
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("modes");
-      for (climate::ClimateMode m : traits.get_supported_modes())
-        opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("fan_modes");
-        for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
-          opt.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
-      }
-
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("custom_fan_modes");
-        for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-          opt.add(custom_fan_mode);
-      }
-      if (traits.get_supports_swing_modes()) {
-        JsonArray opt = root.createNestedArray("swing_modes");
-        for (auto swing_mode : traits.get_supported_swing_modes())
-          opt.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
-      }
-      if (traits.get_supports_presets() && obj->preset.has_value()) {
-        JsonArray opt = root.createNestedArray("presets");
-        for (climate::ClimatePreset m : traits.get_supported_presets())
-          opt.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
-      }
-      if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-        JsonArray opt = root.createNestedArray("custom_presets");
-        for (auto const &custom_preset : traits.get_supported_custom_presets())
-          opt.add(custom_preset);
-      }
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
-      }
+const char *WebServer::climate_json(json::JsonWriter &json, climate::Climate *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "climate-", start_config);
+  const auto traits = obj->get_traits();
+  int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
+  int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
+  char buf[16];
+
+  if (start_config == DETAIL_ALL) {
+    json.begin_array("modes");
+    for (climate::ClimateMode m : traits.get_supported_modes())
+      json.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+    json.end_array();
+    if (!traits.get_supported_custom_fan_modes().empty()) {
+      json.begin_array("fan_modes");
+      for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
+        json.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+      json.end_array();
+    }
+
+    if (!traits.get_supported_custom_fan_modes().empty()) {
+      json.begin_array("custom_fan_modes");
+      for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
+        json.add(custom_fan_mode);
+      json.end_array();
     }
-
-    bool has_state = false;
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-    root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-    root["step"] = traits.get_visual_target_temperature_step();
-    if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-      root["state"] = root["action"];
-      has_state = true;
-    }
-    if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
-    }
-    if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
+    if (traits.get_supports_swing_modes()) {
+      json.begin_array("swing_modes");
+      for (auto swing_mode : traits.get_supported_swing_modes())
+        json.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+      json.end_array();
     }
     if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
+      json.begin_array("presets");
+      for (climate::ClimatePreset m : traits.get_supported_presets())
+        json.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+      json.end_array();
     }
     if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
+      json.begin_array("custom_presets");
+      for (auto const &custom_preset : traits.get_supported_custom_presets())
+        json.add(custom_preset);
+      json.end_array();
     }
-    if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
-    }
-    if (traits.get_supports_current_temperature()) {
-      if (!std::isnan(obj->current_temperature)) {
-        root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      } else {
-        root["current_temperature"] = "NA";
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-    if (traits.get_supports_two_point_target_temperature()) {
-      root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-      root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-      if (!has_state) {
-        root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
-                                                 target_accuracy);
-      }
+  }
+
+  bool has_state = false;
+  json.add("mode", PSTR_LOCAL(climate_mode_to_string(obj->mode)));
+  json.add("max_temp", value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy));
+  json.add("min_temp", value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy));
+  json.add("step", traits.get_visual_target_temperature_step());
+  if (traits.get_supports_action()) {
+    json.add("action", PSTR_LOCAL(climate_action_to_string(obj->action)));
+    json.add("state", buf);
+    has_state = true;
+  }
+  if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
+    json.add("fan_mode", PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value())));
+  }
+  if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
+    json.add("custom_fan_mode", obj->custom_fan_mode.value().c_str());
+  }
+  if (traits.get_supports_presets() && obj->preset.has_value()) {
+    json.add("preset", PSTR_LOCAL(climate_preset_to_string(obj->preset.value())));
+  }
+  if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
+    json.add("custom_preset", obj->custom_preset.value().c_str());
+  }
+  if (traits.get_supports_swing_modes()) {
+    json.add("swing_mode", PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode)));
+  }
+  if (traits.get_supports_current_temperature()) {
+    if (!std::isnan(obj->current_temperature)) {
+      json.add("current_temperature", value_accuracy_to_string(obj->current_temperature, current_accuracy));
     } else {
-      root["target_temperature"] = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-      if (!has_state)
-        root["state"] = root["target_temperature"];
+      json.add("current_temperature", "NA");
     }
-  });
+  }
+  if (traits.get_supports_two_point_target_temperature()) {
+    json.add("target_temperature_low", value_accuracy_to_string(obj->target_temperature_low, target_accuracy));
+    json.add("target_temperature_high", value_accuracy_to_string(obj->target_temperature_high, target_accuracy));
+    if (!has_state) {
+      json.add("state", value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
+                                                 target_accuracy));
+    }
+  } else {
+    const std::string target_temperature = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+    json.add("target_temperature", target_temperature);
+    if (!has_state)
+      json.add("state", target_temperature);
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1270,21 +1343,19 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
 void WebServer::on_lock_update(lock::Lock *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->lock_json(this->event_json_, obj, obj->state, DETAIL_STATE), "state");
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  lock::Lock *obj = App.get_lock_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->lock_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->lock_json(json, obj, obj->state, detail));
     } else if (match.method == "lock") {
       this->schedule_([obj]() { obj->lock(); });
       request->send(200);
@@ -1301,19 +1372,22 @@ void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMat
   }
   request->send(404);
 }
-std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
-                              start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::lock_json(json::JsonWriter &json, lock::Lock *obj, lock::LockState value,
+                                 JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "lock-", lock::lock_state_to_string(value), value,
+                            start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1321,21 +1395,19 @@ std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDet
 void WebServer::on_valve_update(valve::Valve *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->valve_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->valve_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (valve::Valve *obj : App.get_valves()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  valve::Valve *obj = App.get_valve_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->valve_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->valve_json(json, obj, detail));
       return;
     }
 
@@ -1372,23 +1444,25 @@ void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "valve-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
-                              obj->position, start_config);
-    root["current_operation"] = valve::valve_operation_to_str(obj->current_operation);
-
-    if (obj->get_traits().get_supports_position())
-      root["position"] = obj->position;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::valve_json(json::JsonWriter &json, valve::Valve *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_icon_state_value(json, obj, "valve-", obj->is_fully_closed() ? "CLOSED" : "OPEN",
+                            obj->position, start_config);
+  json.add("current_operation", valve::valve_operation_to_str(obj->current_operation));
+
+  if (obj->get_traits().get_supports_position())
+    json.add("position", obj->position);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1396,21 +1470,19 @@ std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->alarm_control_panel_json(this->event_json_, obj, obj->get_state(), DETAIL_STATE), "state");
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  alarm_control_panel::AlarmControlPanel *obj = App.get_alarm_control_panel_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->alarm_control_panel_json(obj, obj->get_state(), detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->alarm_control_panel_json(json, obj, obj->get_state(), detail));
       return;
     }
 
@@ -1440,67 +1512,71 @@ void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *reques
   }
   request->send(404);
 }
-std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
+const char *WebServer::alarm_control_panel_json(json::JsonWriter &json, alarm_control_panel::AlarmControlPanel *obj,
                                                 alarm_control_panel::AlarmControlPanelState value,
                                                 JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    char buf[16];
-    set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
-                              PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+  json.clear();
+  json.begin_object();
+  char buf[16];
+  set_json_icon_state_value(json, obj, "alarm-control-panel-",
+                            PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
 #ifdef USE_EVENT
 void WebServer::on_event(event::Event *obj, const std::string &event_type) {
-  this->events_.send(this->event_json(obj, event_type, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->event_json(this->event_json_, obj, event_type, DETAIL_STATE), "state");
 }
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (event::Event *obj : App.get_events()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  event::Event *obj = App.get_event_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->event_json(obj, "", detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->event_json(json, obj, "", detail));
       return;
     }
   }
   request->send(404);
 }
-std::string WebServer::event_json(event::Event *obj, const std::string &event_type, JsonDetail start_config) {
-  return json::build_json([this, obj, event_type, start_config](JsonObject root) {
-    set_json_id(root, obj, "event-" + obj->get_object_id(), start_config);
-    if (!event_type.empty()) {
-      root["event_type"] = event_type;
+const char *WebServer::event_json(json::JsonWriter &json, event::Event *obj, const std::string &event_type,
+                                  JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "event-", start_config);
+  if (!event_type.empty()) {
+    json.add("event_type", event_type);
+  }
+  if (start_config == DETAIL_ALL) {
+    json.begin_array("event_types");
+    for (auto const &event_type : obj->get_event_types()) {
+      json.add(event_type);
     }
-    if (start_config == DETAIL_ALL) {
-      JsonArray event_types = root.createNestedArray("event_types");
-      for (auto const &event_type : obj->get_event_types()) {
-        event_types.add(event_type);
-      }
-      root["device_class"] = obj->get_device_class();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+    json.end_array();
+    json.add("device_class", obj->get_device_class());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1508,21 +1584,19 @@ std::string WebServer::event_json(event::Event *obj, const std::string &event_ty
 void WebServer::on_update(update::UpdateEntity *obj) {
   if (this->events_.count() == 0)
     return;
-  this->events_.send(this->update_json(obj, DETAIL_STATE).c_str(), "state");
+  this->events_.send(this->update_json(this->event_json_, obj, DETAIL_STATE), "state");
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (update::UpdateEntity *obj : App.get_updates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  update::UpdateEntity *obj = App.get_update_by_object_id(match.id);
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->update_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
+      json::JsonWriter json;
+      request->send(200, "application/json", this->update_json(json, obj, detail));
       return;
     }
 
@@ -1537,37 +1611,39 @@ void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::update_json(update::UpdateEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "update-" + obj->get_object_id(), start_config);
-    root["value"] = obj->update_info.latest_version;
-    switch (obj->state) {
-      case update::UPDATE_STATE_NO_UPDATE:
-        root["state"] = "NO UPDATE";
-        break;
-      case update::UPDATE_STATE_AVAILABLE:
-        root["state"] = "UPDATE AVAILABLE";
-        break;
-      case update::UPDATE_STATE_INSTALLING:
-        root["state"] = "INSTALLING";
-        break;
-      default:
-        root["state"] = "UNKNOWN";
-        break;
-    }
-    if (start_config == DETAIL_ALL) {
-      root["current_version"] = obj->update_info.current_version;
-      root["title"] = obj->update_info.title;
-      root["summary"] = obj->update_info.summary;
-      root["release_url"] = obj->update_info.release_url;
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-        if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
-        }
+const char *WebServer::update_json(json::JsonWriter &json, update::UpdateEntity *obj, JsonDetail start_config) {
+  json.clear();
+  json.begin_object();
+  set_json_id(json, obj, "update-", start_config);
+  json.add("value", obj->update_info.latest_version);
+  switch (obj->state) {
+    case update::UPDATE_STATE_NO_UPDATE:
+      json.add("state", "NO UPDATE");
+      break;
+    case update::UPDATE_STATE_AVAILABLE:
+      json.add("state", "UPDATE AVAILABLE");
+      break;
+    case update::UPDATE_STATE_INSTALLING:
+      json.add("state", "INSTALLING");
+      break;
+    default:
+      json.add("state", "UNKNOWN");
+      break;
+  }
+  if (start_config == DETAIL_ALL) {
+    json.add("current_version", obj->update_info.current_version);
+    json.add("title", obj->update_info.title);
+    json.add("summary", obj->update_info.summary);
+    json.add("release_url", obj->update_info.release_url);
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      json.add("sorting_weight", this->sorting_entitys_[obj].weight);
+      if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
+        json.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
       }
     }
-  });
+  }
+  json.end_object();
+  return json.c_str();
 }
 #endif
 
@@ -1585,6 +1661,11 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
     return true;
 #endif
 
+#ifdef USE_PROFILER
+  if (request->url() == "/profile" && profiler::global_profiler != nullptr)
+    return true;
+#endif
+
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
   if (request->method() == HTTP_OPTIONS && request->hasHeader(HEADER_CORS_REQ_PNA)) {
 #ifdef USE_ARDUINO
@@ -1722,6 +1803,13 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
+#ifdef USE_PROFILER
+  if (request->url() == "/profile") {
+    this->handle_profile_request(request);
+    return;
+  }
+#endif
+
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
   if (request->method() == HTTP_OPTIONS && request->hasHeader(HEADER_CORS_REQ_PNA)) {
     this->handle_pna_cors_request(request);
@@ -284,9 +284,49 @@ void AsyncEventSource::handleRequest(AsyncWebServerRequest *request) {
 }
 
 void AsyncEventSource::send(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
+  if (this->sessions_.empty())
+    return;
+  build_event_(this->event_buffer_, message, event, id, reconnect);
+  if (this->event_buffer_.empty())
+    return;
   for (auto *ses : this->sessions_) {
-    ses->send(message, event, id, reconnect);
+    ses->send_event_(this->event_buffer_);
+  }
+}
+
+void AsyncEventSource::build_event_(std::string &ev, const char *message, const char *event, uint32_t id,
+                                    uint32_t reconnect) {
+  ev.clear();
+
+  if (reconnect) {
+    ev.append("retry: ", sizeof("retry: ") - 1);
+    ev.append(to_string(reconnect));
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (id) {
+    ev.append("id: ", sizeof("id: ") - 1);
+    ev.append(to_string(id));
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (event && *event) {
+    ev.append("event: ", sizeof("event: ") - 1);
+    ev.append(event);
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (message && *message) {
+    ev.append("data: ", sizeof("data: ") - 1);
+    ev.append(message);
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (ev.empty()) {
+    return;
   }
+
+  ev.append(CRLF_STR, CRLF_LEN);
 }
 
 AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *request, AsyncEventSource *server)
@@ -322,41 +362,25 @@ void AsyncEventSourceResponse::send(const char *message, const char *event, uint
     return;
   }
 
+  // Called from the onConnect callback on the httpd task, while the main loop may be formatting into the shared
+  // event_buffer_ of the server
   std::string ev;
-
-  if (reconnect) {
-    ev.append("retry: ", sizeof("retry: ") - 1);
-    ev.append(to_string(reconnect));
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (id) {
-    ev.append("id: ", sizeof("id: ") - 1);
-    ev.append(to_string(id));
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (event && *event) {
-    ev.append("event: ", sizeof("event: ") - 1);
-    ev.append(event);
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (message && *message) {
-    ev.append("data: ", sizeof("data: ") - 1);
-    ev.append(message);
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
+  AsyncEventSource::build_event_(ev, message, event, id, reconnect);
   if (ev.empty()) {
     return;
   }
+  this->send_event_(ev);
+}
 
-  ev.append(CRLF_STR, CRLF_LEN);
+void AsyncEventSourceResponse::send_event_(const std::string &ev) {
+  if (this->fd_ == 0) {
+    return;
+  }
 
   // Sending chunked content prelude
-  auto cs = str_snprintf("%x" CRLF_STR, 4 * sizeof(ev.size()) + CRLF_LEN, ev.size());
-  httpd_socket_send(this->hd_, this->fd_, cs.c_str(), cs.size(), 0);
+  char cs[2 * sizeof(size_t) + CRLF_LEN + 1];
+  const int cs_len = snprintf(cs, sizeof(cs), "%x" CRLF_STR, (unsigned) ev.size());
+  httpd_socket_send(this->hd_, this->fd_, cs, cs_len, 0);
 
   // Sendiing content chunk
   httpd_socket_send(this->hd_, this->fd_, ev.c_str(), ev.size(), 0);
@@ -225,6 +225,8 @@ class AsyncEventSourceResponse {
  protected:
   AsyncEventSourceResponse(const AsyncWebServerRequest *request, AsyncEventSource *server);
   static void destroy(void *p);
+  /// Send an event that has already been formatted by AsyncEventSource::build_event_().
+  void send_event_(const std::string &ev);
   AsyncEventSource *server_;
   httpd_handle_t hd_{};
   int fd_{};
@@ -254,8 +256,13 @@ class AsyncEventSource : public AsyncWebHandler {
   size_t count() const { return this->sessions_.size(); }
 
  protected:
+  static void build_event_(std::string &ev, const char *message, const char *event, uint32_t id, uint32_t reconnect);
+
   std::string url_;
   std::set<AsyncEventSourceResponse *> sessions_;
+  /// The event being sent, formatted once for all sessions. Reused so that sending events doesn't allocate, only
+  /// used by send() on the main loop.
+  std::string event_buffer_;
   connect_handler_t on_connect_{};
 };
 
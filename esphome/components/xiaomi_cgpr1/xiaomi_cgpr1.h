@@ -13,9 +13,8 @@ namespace xiaomi_cgpr1 {
 
 class XiaomiCGPR1 : public Component,
                     public binary_sensor::BinarySensorInitiallyOff,
-                    public esp32_ble_tracker::ESPBTDeviceListener {
+                    public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; }
   void set_bindkey(const std::string &bindkey);
 
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
@@ -27,7 +26,6 @@ class XiaomiCGPR1 : public Component,
   void set_idle_time(sensor::Sensor *idle_time) { idle_time_ = idle_time; }
 
  protected:
-  uint64_t address_;
   uint8_t bindkey_[16];
   sensor::Sensor *idle_time_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
@@ -10,10 +10,8 @@
 namespace esphome {
 namespace xiaomi_jqjcy01ym {
 
-class XiaomiJQJCY01YM : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiJQJCY01YM : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 
   void dump_config() override;
@@ -24,7 +22,6 @@ class XiaomiJQJCY01YM : public Component, public esp32_ble_tracker::ESPBTDeviceL
   void set_battery_level(sensor::Sensor *battery_level) { battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
   sensor::Sensor *formaldehyde_{nullptr};
@@ -10,9 +10,8 @@
 namespace esphome {
 namespace xiaomi_lywsd02mmc {
 
-class XiaomiLYWSD02MMC : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiLYWSD02MMC : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { this->address_ = address; }
   void set_bindkey(const std::string &bindkey);
 
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
@@ -24,7 +23,6 @@ class XiaomiLYWSD02MMC : public Component, public esp32_ble_tracker::ESPBTDevice
   void set_battery_level(sensor::Sensor *battery_level) { this->battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
   uint8_t bindkey_[16];
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
@@ -17,10 +17,8 @@ struct ParseResult {
   optional<float> impedance;
 };
 
-class XiaomiMiscale : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiMiscale : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; };
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -29,7 +27,6 @@ class XiaomiMiscale : public Component, public esp32_ble_tracker::ESPBTDeviceLis
   void set_clear_impedance(bool clear_impedance) { clear_impedance_ = clear_impedance; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *weight_{nullptr};
   sensor::Sensor *impedance_{nullptr};
   bool clear_impedance_{false};
@@ -12,10 +12,8 @@ namespace xiaomi_mue4094rt {
 
 class XiaomiMUE4094RT : public Component,
                         public binary_sensor::BinarySensorInitiallyOff,
-                        public esp32_ble_tracker::ESPBTDeviceListener {
+                        public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 
   void dump_config() override;
@@ -23,7 +21,6 @@ class XiaomiMUE4094RT : public Component,
   void set_time(uint16_t timeout) { timeout_ = timeout; }
 
  protected:
-  uint64_t address_;
   uint16_t timeout_;
 };
 
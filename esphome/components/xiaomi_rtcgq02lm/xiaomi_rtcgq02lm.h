@@ -16,9 +16,8 @@
 namespace esphome {
 namespace xiaomi_rtcgq02lm {
 
-class XiaomiRTCGQ02LM : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiRTCGQ02LM : public Component, public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; };
   void set_bindkey(const std::string &bindkey);
 
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
@@ -39,7 +38,6 @@ class XiaomiRTCGQ02LM : public Component, public esp32_ble_tracker::ESPBTDeviceL
 #endif
 
  protected:
-  uint64_t address_;
   uint8_t bindkey_[16];
 
 #ifdef USE_BINARY_SENSOR
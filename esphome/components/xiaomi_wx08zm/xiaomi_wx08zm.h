@@ -13,10 +13,8 @@ namespace xiaomi_wx08zm {
 
 class XiaomiWX08ZM : public Component,
                      public binary_sensor::BinarySensorInitiallyOff,
-                     public esp32_ble_tracker::ESPBTDeviceListener {
+                     public esp32_ble_tracker::ESPBTDeviceAddressListener {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 
   void dump_config() override;
@@ -25,7 +23,6 @@ class XiaomiWX08ZM : public Component,
   void set_battery_level(sensor::Sensor *battery_level) { battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *tablet_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
 };
@@ -3,10 +3,17 @@
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
 
+#include <cerrno>
+#include <utility>
+
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
@@ -62,28 +69,60 @@ void Application::setup() {
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // The network stack is up once all components are set up
+  this->setup_wake_loop_();
+#endif
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
 
+#ifdef USE_PROFILER
+  profiler::Profiler *profiler = profiler::global_profiler;
+  if (profiler != nullptr)
+    profiler->record_iteration_start(micros());
+#endif
+
+  if (this->has_pending_enable_loop_requests_)
+    this->enable_pending_loops_();
+
   this->scheduler.call();
   this->feed_wdt();
-  for (Component *component : this->looping_components_) {
+  this->in_loop_ = true;
+  for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;
+       this->current_loop_index_++) {
+    Component *component = this->looping_components_[this->current_loop_index_];
     {
       WarnIfComponentBlockingGuard guard{component};
+#ifdef USE_PROFILER
+      const uint32_t started = micros();
       component->call();
+      if (profiler != nullptr)
+        profiler->record_loop(component, micros() - started);
+#else
+      component->call();
+#endif
     }
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
     this->feed_wdt();
   }
+  this->in_loop_ = false;
+  // Components with a disabled loop still report their status
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++)
+    new_app_state |= this->looping_components_[i]->get_component_state();
   this->app_state_ = new_app_state;
 
+#ifdef USE_PROFILER
+  if (profiler != nullptr)
+    profiler->record_iteration_end(micros());
+#endif
+
   const uint32_t now = millis();
 
   auto elapsed = now - this->last_loop_;
   if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
-    yield();
+    this->yield_with_select_(0);
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
     uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
@@ -91,7 +130,7 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    this->yield_with_select_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -148,8 +187,142 @@ void Application::calculate_looping_components_() {
     if (obj->has_overridden_loop())
       this->looping_components_.push_back(obj);
   }
+  // Components may already have disabled their loop during setup()
+  auto active_end = std::stable_partition(
+      this->looping_components_.begin(), this->looping_components_.end(), [](const Component *component) {
+        return (component->get_component_state() & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE;
+      });
+  this->looping_components_active_end_ = active_end - this->looping_components_.begin();
+}
+
+void Application::disable_component_loop_(Component *component) {
+  for (size_t i = 0; i < this->looping_components_active_end_; i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    // Keep the loop order of the remaining active components
+    std::rotate(this->looping_components_.begin() + i, this->looping_components_.begin() + i + 1,
+                this->looping_components_.begin() + this->looping_components_active_end_);
+    this->looping_components_active_end_--;
+    // Everything behind i moved down by one, don't skip the component that now sits at the current index
+    if (this->in_loop_ && i <= this->current_loop_index_)
+      this->current_loop_index_--;
+    return;
+  }
+}
+void Application::enable_component_loop_(Component *component) {
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    // Re-enabled components run after the ones that stayed active, including later in the current iteration
+    std::swap(this->looping_components_[i], this->looping_components_[this->looping_components_active_end_]);
+    this->looping_components_active_end_++;
+    return;
+  }
+}
+void Application::enable_pending_loops_() {
+  // Clear first, a request arriving while scanning is then handled in the next iteration
+  this->has_pending_enable_loop_requests_ = false;
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    Component *component = this->looping_components_[i];
+    if (component->pending_enable_loop_)
+      component->enable_loop();
+  }
+}
+
+void Application::yield_with_select_(uint32_t delay_ms) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  if (!this->socket_fds_.empty()) {
+    if (this->socket_fds_changed_) {
+      FD_ZERO(&this->base_read_fds_);
+      this->max_fd_ = -1;
+      for (int fd : this->socket_fds_) {
+        FD_SET(fd, &this->base_read_fds_);
+        this->max_fd_ = std::max(this->max_fd_, fd);
+      }
+      this->socket_fds_changed_ = false;
+    }
+
+    this->read_fds_ = this->base_read_fds_;
+    struct timeval tv;
+    tv.tv_sec = delay_ms / 1000;
+    tv.tv_usec = (delay_ms % 1000) * 1000;
+#ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
+    int ret = lwip_select(this->max_fd_ + 1, &this->read_fds_, nullptr, nullptr, &tv);
+#else
+    int ret = ::select(this->max_fd_ + 1, &this->read_fds_, nullptr, nullptr, &tv);
+#endif
+    if (ret < 0) {
+      // Don't let a failed select() starve the sockets, report all as ready and sleep the regular way
+      ESP_LOGVV(TAG, "select() failed: errno=%d", errno);
+      this->read_fds_ = this->base_read_fds_;
+      delay(delay_ms);
+      return;
+    }
+    if (this->wake_socket_ != nullptr && this->wake_socket_->ready()) {
+      uint8_t buf[16];
+      while (this->wake_socket_->read(buf, sizeof(buf)) > 0) {
+      }
+    }
+    if (delay_ms == 0)
+      yield();
+    return;
+  }
+#endif
+  if (delay_ms == 0) {
+    yield();
+  } else {
+    delay(delay_ms);
+  }
 }
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+bool Application::register_socket_fd(int fd) {
+  if (fd < 0 || fd >= FD_SETSIZE) {
+    ESP_LOGW(TAG, "Socket fd %d can't be monitored, it will be polled instead", fd);
+    return false;
+  }
+  this->socket_fds_.push_back(fd);
+  this->socket_fds_changed_ = true;
+  return true;
+}
+void Application::unregister_socket_fd(int fd) {
+  for (size_t i = 0; i < this->socket_fds_.size(); i++) {
+    if (this->socket_fds_[i] != fd)
+      continue;
+    this->socket_fds_[i] = this->socket_fds_.back();
+    this->socket_fds_.pop_back();
+    this->socket_fds_changed_ = true;
+    // The fd number may be reused right away, don't report it as ready from the last select()
+    FD_CLR(fd, &this->read_fds_);
+    return;
+  }
+}
+void Application::setup_wake_loop_() {
+  auto sock = socket::socket_loop_monitored(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock == nullptr)
+    return;
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t len = sizeof(addr);
+  if (sock->bind((struct sockaddr *) &addr, len) != 0 || sock->getsockname((struct sockaddr *) &addr, &len) != 0) {
+    ESP_LOGW(TAG, "Could not set up loop wakeup socket: errno=%d", errno);
+    return;
+  }
+  sock->setblocking(false);
+  this->wake_addr_ = addr;
+  this->wake_socket_ = std::move(sock);
+}
+void Application::wake_loop_threadsafe() {
+  if (this->wake_socket_ == nullptr)
+    return;
+  const uint8_t dummy = 0;
+  // Failures (e.g. a full socket buffer) don't matter, a wakeup is already pending then
+  this->wake_socket_->sendto(&dummy, 1, 0, (struct sockaddr *) &this->wake_addr_, sizeof(this->wake_addr_));
+}
+#endif
+
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace esphome
@@ -9,6 +9,15 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include "esphome/components/socket/socket.h"
+#ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
+#include <lwip/sockets.h>
+#else
+#include <sys/select.h>
+#endif
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -233,6 +242,22 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  /** Wake the main loop whenever the given socket becomes readable.
+   *
+   * While idle, the main loop waits in select() on all registered sockets instead of sleeping for the rest of the
+   * loop interval. Use socket::socket_loop_monitored() instead of calling this directly.
+   *
+   * @return Whether the socket is monitored, false if the file descriptor can't be used with select().
+   */
+  bool register_socket_fd(int fd);
+  void unregister_socket_fd(int fd);
+  /// Whether the socket was readable when the main loop last woke up.
+  bool is_socket_ready(int fd) const { return FD_ISSET(fd, &this->read_fds_); }
+  /// Wake the main loop from its sleep. Safe to call from other tasks, but not from interrupts.
+  void wake_loop_threadsafe();
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -246,181 +271,163 @@ class Application {
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->binary_sensors_by_key_.find(this->binary_sensors_, key, include_internal);
+  }
+  binary_sensor::BinarySensor *get_binary_sensor_by_object_id(const std::string &object_id) {
+    return this->binary_sensors_by_key_.find(this->binary_sensors_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->switches_by_key_.find(this->switches_, key, include_internal);
+  }
+  switch_::Switch *get_switch_by_object_id(const std::string &object_id) {
+    return this->switches_by_key_.find(this->switches_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_BUTTON
   const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
   button::Button *get_button_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->buttons_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->buttons_by_key_.find(this->buttons_, key, include_internal);
+  }
+  button::Button *get_button_by_object_id(const std::string &object_id) {
+    return this->buttons_by_key_.find(this->buttons_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->sensors_by_key_.find(this->sensors_, key, include_internal);
+  }
+  sensor::Sensor *get_sensor_by_object_id(const std::string &object_id) {
+    return this->sensors_by_key_.find(this->sensors_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->text_sensors_by_key_.find(this->text_sensors_, key, include_internal);
+  }
+  text_sensor::TextSensor *get_text_sensor_by_object_id(const std::string &object_id) {
+    return this->text_sensors_by_key_.find(this->text_sensors_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
   fan::Fan *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->fans_by_key_.find(this->fans_, key, include_internal);
+  }
+  fan::Fan *get_fan_by_object_id(const std::string &object_id) {
+    return this->fans_by_key_.find(this->fans_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->covers_by_key_.find(this->covers_, key, include_internal);
+  }
+  cover::Cover *get_cover_by_object_id(const std::string &object_id) {
+    return this->covers_by_key_.find(this->covers_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->lights_by_key_.find(this->lights_, key, include_internal);
+  }
+  light::LightState *get_light_by_object_id(const std::string &object_id) {
+    return this->lights_by_key_.find(this->lights_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->climates_by_key_.find(this->climates_, key, include_internal);
+  }
+  climate::Climate *get_climate_by_object_id(const std::string &object_id) {
+    return this->climates_by_key_.find(this->climates_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->numbers_by_key_.find(this->numbers_, key, include_internal);
+  }
+  number::Number *get_number_by_object_id(const std::string &object_id) {
+    return this->numbers_by_key_.find(this->numbers_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_DATETIME_DATE
   const std::vector<datetime::DateEntity *> &get_dates() { return this->dates_; }
   datetime::DateEntity *get_date_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->dates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->dates_by_key_.find(this->dates_, key, include_internal);
+  }
+  datetime::DateEntity *get_date_by_object_id(const std::string &object_id) {
+    return this->dates_by_key_.find(this->dates_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_DATETIME_TIME
   const std::vector<datetime::TimeEntity *> &get_times() { return this->times_; }
   datetime::TimeEntity *get_time_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->times_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->times_by_key_.find(this->times_, key, include_internal);
+  }
+  datetime::TimeEntity *get_time_by_object_id(const std::string &object_id) {
+    return this->times_by_key_.find(this->times_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_DATETIME_DATETIME
   const std::vector<datetime::DateTimeEntity *> &get_datetimes() { return this->datetimes_; }
   datetime::DateTimeEntity *get_datetime_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->datetimes_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->datetimes_by_key_.find(this->datetimes_, key, include_internal);
+  }
+  datetime::DateTimeEntity *get_datetime_by_object_id(const std::string &object_id) {
+    return this->datetimes_by_key_.find(this->datetimes_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_TEXT
   const std::vector<text::Text *> &get_texts() { return this->texts_; }
   text::Text *get_text_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->texts_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->texts_by_key_.find(this->texts_, key, include_internal);
+  }
+  text::Text *get_text_by_object_id(const std::string &object_id) {
+    return this->texts_by_key_.find(this->texts_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_SELECT
   const std::vector<select::Select *> &get_selects() { return this->selects_; }
   select::Select *get_select_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->selects_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->selects_by_key_.find(this->selects_, key, include_internal);
+  }
+  select::Select *get_select_by_object_id(const std::string &object_id) {
+    return this->selects_by_key_.find(this->selects_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_LOCK
   const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
   lock::Lock *get_lock_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->locks_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->locks_by_key_.find(this->locks_, key, include_internal);
+  }
+  lock::Lock *get_lock_by_object_id(const std::string &object_id) {
+    return this->locks_by_key_.find(this->locks_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_VALVE
   const std::vector<valve::Valve *> &get_valves() { return this->valves_; }
   valve::Valve *get_valve_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->valves_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->valves_by_key_.find(this->valves_, key, include_internal);
+  }
+  valve::Valve *get_valve_by_object_id(const std::string &object_id) {
+    return this->valves_by_key_.find(this->valves_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 #ifdef USE_MEDIA_PLAYER
   const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
   media_player::MediaPlayer *get_media_player_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->media_players_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->media_players_by_key_.find(this->media_players_, key, include_internal);
+  }
+  media_player::MediaPlayer *get_media_player_by_object_id(const std::string &object_id) {
+    return this->media_players_by_key_.find(this->media_players_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 
@@ -429,33 +436,30 @@ class Application {
     return this->alarm_control_panels_;
   }
   alarm_control_panel::AlarmControlPanel *get_alarm_control_panel_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->alarm_control_panels_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->alarm_control_panels_by_key_.find(this->alarm_control_panels_, key, include_internal);
+  }
+  alarm_control_panel::AlarmControlPanel *get_alarm_control_panel_by_object_id(const std::string &object_id) {
+    return this->alarm_control_panels_by_key_.find(this->alarm_control_panels_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 
 #ifdef USE_EVENT
   const std::vector<event::Event *> &get_events() { return this->events_; }
   event::Event *get_event_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->events_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->events_by_key_.find(this->events_, key, include_internal);
+  }
+  event::Event *get_event_by_object_id(const std::string &object_id) {
+    return this->events_by_key_.find(this->events_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 
 #ifdef USE_UPDATE
   const std::vector<update::UpdateEntity *> &get_updates() { return this->updates_; }
   update::UpdateEntity *get_update_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->updates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->updates_by_key_.find(this->updates_, key, include_internal);
+  }
+  update::UpdateEntity *get_update_by_object_id(const std::string &object_id) {
+    return this->updates_by_key_.find(this->updates_, fnv1_hash(object_id), true, &object_id);
   }
 #endif
 
@@ -468,73 +472,126 @@ class Application {
 
   void calculate_looping_components_();
 
+  // Move a component between the active and the inactive part of looping_components_, see Component::disable_loop().
+  void disable_component_loop_(Component *component);
+  void enable_component_loop_(Component *component);
+  /// Enable the loops of all components that called Component::enable_loop_soon_any_context().
+  void enable_pending_loops_();
+
   void feed_wdt_arch_();
 
+  /// Sleep for up to delay_ms, returning early when a monitored socket becomes readable.
+  void yield_with_select_(uint32_t delay_ms);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  void setup_wake_loop_();
+#endif
+
   std::vector<Component *> components_{};
+  /// All components with a loop(), partitioned in place: the ones in [0, looping_components_active_end_) are
+  /// called every iteration, the rest have disabled their loop.
   std::vector<Component *> looping_components_{};
+  size_t looping_components_active_end_{0};
+  /// Index into looping_components_ of the component currently being called, while in_loop_ is set.
+  size_t current_loop_index_{0};
+  bool in_loop_{false};
+  volatile bool has_pending_enable_loop_requests_{false};
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  std::vector<int> socket_fds_{};
+  /// Set of all registered sockets, rebuilt when socket_fds_ changes.
+  fd_set base_read_fds_{};
+  /// Sockets found readable by the last select() call.
+  fd_set read_fds_{};
+  int max_fd_{-1};
+  bool socket_fds_changed_{false};
+  /// Loopback UDP socket that wake_loop_threadsafe() sends to.
+  std::unique_ptr<socket::Socket> wake_socket_{nullptr};
+  struct sockaddr_in wake_addr_ {};
+#endif
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityKeyIndex<binary_sensor::BinarySensor> binary_sensors_by_key_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityKeyIndex<switch_::Switch> switches_by_key_{};
 #endif
 #ifdef USE_BUTTON
   std::vector<button::Button *> buttons_{};
+  EntityKeyIndex<button::Button> buttons_by_key_{};
 #endif
 #ifdef USE_EVENT
   std::vector<event::Event *> events_{};
+  EntityKeyIndex<event::Event> events_by_key_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityKeyIndex<sensor::Sensor> sensors_by_key_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityKeyIndex<text_sensor::TextSensor> text_sensors_by_key_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::Fan *> fans_{};
+  EntityKeyIndex<fan::Fan> fans_by_key_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityKeyIndex<cover::Cover> covers_by_key_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityKeyIndex<climate::Climate> climates_by_key_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityKeyIndex<light::LightState> lights_by_key_{};
 #endif
 #ifdef USE_NUMBER
   std::vector<number::Number *> numbers_{};
+  EntityKeyIndex<number::Number> numbers_by_key_{};
 #endif
 #ifdef USE_DATETIME_DATE
   std::vector<datetime::DateEntity *> dates_{};
+  EntityKeyIndex<datetime::DateEntity> dates_by_key_{};
 #endif
 #ifdef USE_DATETIME_TIME
   std::vector<datetime::TimeEntity *> times_{};
+  EntityKeyIndex<datetime::TimeEntity> times_by_key_{};
 #endif
 #ifdef USE_DATETIME_DATETIME
   std::vector<datetime::DateTimeEntity *> datetimes_{};
+  EntityKeyIndex<datetime::DateTimeEntity> datetimes_by_key_{};
 #endif
 #ifdef USE_SELECT
   std::vector<select::Select *> selects_{};
+  EntityKeyIndex<select::Select> selects_by_key_{};
 #endif
 #ifdef USE_TEXT
   std::vector<text::Text *> texts_{};
+  EntityKeyIndex<text::Text> texts_by_key_{};
 #endif
 #ifdef USE_LOCK
   std::vector<lock::Lock *> locks_{};
+  EntityKeyIndex<lock::Lock> locks_by_key_{};
 #endif
 #ifdef USE_VALVE
   std::vector<valve::Valve *> valves_{};
+  EntityKeyIndex<valve::Valve> valves_by_key_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
   std::vector<media_player::MediaPlayer *> media_players_{};
+  EntityKeyIndex<media_player::MediaPlayer> media_players_by_key_{};
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
   std::vector<alarm_control_panel::AlarmControlPanel *> alarm_control_panels_{};
+  EntityKeyIndex<alarm_control_panel::AlarmControlPanel> alarm_control_panels_by_key_{};
 #endif
 #ifdef USE_UPDATE
   std::vector<update::UpdateEntity *> updates_{};
+  EntityKeyIndex<update::UpdateEntity> updates_by_key_{};
 #endif
 
   std::string name_;
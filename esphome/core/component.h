@@ -58,6 +58,7 @@ extern const uint32_t COMPONENT_STATE_CONSTRUCTION;
 extern const uint32_t COMPONENT_STATE_SETUP;
 extern const uint32_t COMPONENT_STATE_LOOP;
 extern const uint32_t COMPONENT_STATE_FAILED;
+extern const uint32_t COMPONENT_STATE_LOOP_DONE;
 extern const uint32_t STATUS_LED_MASK;
 extern const uint32_t STATUS_LED_OK;
 extern const uint32_t STATUS_LED_WARNING;
@@ -142,6 +143,23 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() until enable_loop() is called.
+   *
+   * Components that only have work to do in loop() some of the time should disable their loop while idle,
+   * so the main loop doesn't spend time on them. Timeouts and intervals keep running. Must be called from the
+   * main loop task.
+   */
+  void disable_loop();
+
+  /// Resume calling loop() after disable_loop(). Must be called from the main loop task.
+  void enable_loop();
+
+  /** Resume calling loop() from the next main loop iteration on.
+   *
+   * Unlike enable_loop(), this only sets a flag and is therefore safe to call from interrupts and other tasks.
+   */
+  void enable_loop_soon_any_context();
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -270,6 +288,8 @@ class Component {
   bool cancel_defer(const std::string &name);  // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
+  /// Set by enable_loop_soon_any_context(), picked up by the application at the start of the next loop iteration.
+  volatile bool pending_enable_loop_{false};
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
 };
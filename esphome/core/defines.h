@@ -17,6 +17,7 @@
 // Feature flags
 #define USE_ALARM_CONTROL_PANEL
 #define USE_API
+#define USE_API_LIST_ENTITIES_CACHE
 #define USE_API_NOISE
 #define USE_API_PLAINTEXT
 #define USE_BINARY_SENSOR
@@ -56,6 +57,7 @@
 #define USE_MD5
 #define USE_MDNS
 #define USE_MEDIA_PLAYER
+#define USE_MODBUS_TCP
 #define USE_MQTT
 #define USE_NETWORK
 #define USE_NEXTION_TFT_UPLOAD
@@ -69,6 +71,7 @@
 #define USE_OTA_VERSION 1
 #define USE_OUTPUT
 #define USE_POWER_SUPPLY
+#define USE_PROFILER
 #define USE_QR_CODE
 #define USE_SELECT
 #define USE_SENSOR
@@ -109,6 +112,7 @@
 #define USE_MICROPHONE
 #define USE_PSRAM
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #define USE_SPEAKER
 #define USE_SPI
 #define USE_VOICE_ASSISTANT
@@ -165,12 +169,14 @@
 #ifdef USE_LIBRETINY
 #define USE_CAPTIVE_PORTAL
 #define USE_SOCKET_IMPL_LWIP_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #define USE_WEBSERVER
 #define USE_WEBSERVER_PORT 80  // NOLINT
 #endif
 
 #ifdef USE_HOST
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #endif
 
 // Disabled feature flags
@@ -2,10 +2,22 @@
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 
+#ifdef USE_API_LIST_ENTITIES_CACHE
+#include "esphome/components/api/api_server.h"
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "entity_base";
 
+// The native API encodes the metadata of all entities once for all clients, it has to encode them again after a change
+static void metadata_changed() {
+#ifdef USE_API_LIST_ENTITIES_CACHE
+  if (api::global_api_server != nullptr)
+    api::global_api_server->get_list_entities_cache().invalidate();
+#endif
+}
+
 // Entity Name
 const StringRef &EntityBase::get_name() const { return this->name_; }
 void EntityBase::set_name(const char *name) {
@@ -16,15 +28,22 @@ void EntityBase::set_name(const char *name) {
   } else {
     this->has_own_name_ = true;
   }
+  metadata_changed();
 }
 
 // Entity Internal
 bool EntityBase::is_internal() const { return this->internal_; }
-void EntityBase::set_internal(bool internal) { this->internal_ = internal; }
+void EntityBase::set_internal(bool internal) {
+  this->internal_ = internal;
+  metadata_changed();
+}
 
 // Entity Disabled by Default
 bool EntityBase::is_disabled_by_default() const { return this->disabled_by_default_; }
-void EntityBase::set_disabled_by_default(bool disabled_by_default) { this->disabled_by_default_ = disabled_by_default; }
+void EntityBase::set_disabled_by_default(bool disabled_by_default) {
+  this->disabled_by_default_ = disabled_by_default;
+  metadata_changed();
+}
 
 // Entity Icon
 std::string EntityBase::get_icon() const {
@@ -33,11 +52,17 @@ std::string EntityBase::get_icon() const {
   }
   return this->icon_c_str_;
 }
-void EntityBase::set_icon(const char *icon) { this->icon_c_str_ = icon; }
+void EntityBase::set_icon(const char *icon) {
+  this->icon_c_str_ = icon;
+  metadata_changed();
+}
 
 // Entity Category
 EntityCategory EntityBase::get_entity_category() const { return this->entity_category_; }
-void EntityBase::set_entity_category(EntityCategory entity_category) { this->entity_category_ = entity_category; }
+void EntityBase::set_entity_category(EntityCategory entity_category) {
+  this->entity_category_ = entity_category;
+  metadata_changed();
+}
 
 // Entity Object ID
 std::string EntityBase::get_object_id() const {
@@ -53,9 +78,17 @@ std::string EntityBase::get_object_id() const {
     return this->object_id_c_str_;
   }
 }
+const char *EntityBase::get_static_object_id() const {
+  if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled())
+    return nullptr;
+  if (this->object_id_c_str_ == nullptr)
+    return "";
+  return this->object_id_c_str_;
+}
 void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
   this->calc_object_id_();
+  metadata_changed();
 }
 
 // Calculate Object ID Hash from Entity Name
@@ -82,7 +115,10 @@ std::string EntityBase_DeviceClass::get_device_class() {
   return this->device_class_;
 }
 
-void EntityBase_DeviceClass::set_device_class(const char *device_class) { this->device_class_ = device_class; }
+void EntityBase_DeviceClass::set_device_class(const char *device_class) {
+  this->device_class_ = device_class;
+  metadata_changed();
+}
 
 std::string EntityBase_UnitOfMeasurement::get_unit_of_measurement() {
   if (this->unit_of_measurement_ == nullptr)
@@ -91,6 +127,7 @@ std::string EntityBase_UnitOfMeasurement::get_unit_of_measurement() {
 }
 void EntityBase_UnitOfMeasurement::set_unit_of_measurement(const char *unit_of_measurement) {
   this->unit_of_measurement_ = unit_of_measurement;
+  metadata_changed();
 }
 
 }  // namespace esphome
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <cstdint>
+#include <vector>
 #include "string_ref.h"
 
 namespace esphome {
@@ -25,6 +27,8 @@ class EntityBase {
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
   void set_object_id(const char *object_id);
+  // Get the object ID without copying it, nullptr if it is derived from the device friendly_name at runtime.
+  const char *get_static_object_id() const;
 
   // Get the unique Object ID of this Entity
   uint32_t get_object_id_hash();
@@ -85,4 +89,35 @@ class EntityBase_UnitOfMeasurement {  // NOLINT(readability-identifier-naming)
   const char *unit_of_measurement_{nullptr};  ///< Unit of measurement override
 };
 
+/** Lookup of the entities of one domain by their object id hash (the key used by the native API).
+ *
+ * Keeps a copy of the registry sorted by key for binary search; it is rebuilt whenever the registry changed size,
+ * i.e. once after all entities are registered. Keys can't be sorted at compile time as they depend on the MAC
+ * address for devices with name_add_mac_suffix.
+ */
+template<typename T> class EntityKeyIndex {
+ public:
+  /// Find the first entity with the given key. If object_id is given, entities with the same key but a different
+  /// object id (a hash collision) are skipped.
+  T *find(const std::vector<T *> &entities, uint32_t key, bool include_internal,
+          const std::string *object_id = nullptr) {
+    if (this->sorted_.size() != entities.size()) {
+      this->sorted_ = entities;
+      // Stable, so that on a key collision the first registered entity wins like in a linear scan
+      std::stable_sort(this->sorted_.begin(), this->sorted_.end(),
+                       [](T *a, T *b) { return a->get_object_id_hash() < b->get_object_id_hash(); });
+    }
+    auto it = std::lower_bound(this->sorted_.begin(), this->sorted_.end(), key,
+                               [](T *obj, uint32_t key) { return obj->get_object_id_hash() < key; });
+    for (; it != this->sorted_.end() && (*it)->get_object_id_hash() == key; ++it) {
+      if ((include_internal || !(*it)->is_internal()) && (object_id == nullptr || (*it)->get_object_id() == *object_id))
+        return *it;
+    }
+    return nullptr;
+  }
+
+ protected:
+  std::vector<T *> sorted_{};
+};
+
 }  // namespace esphome
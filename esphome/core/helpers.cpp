@@ -434,14 +434,20 @@ ParseOnOffState parse_on_off(const char *str, const char *on, const char *off) {
 }
 
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals) {
+  char tmp[32];  // should be enough, but we should maybe improve this at some point.
+  value_accuracy_to_buf(tmp, sizeof(tmp), value, accuracy_decimals);
+  return std::string(tmp);
+}
+size_t value_accuracy_to_buf(char *buf, size_t buf_len, float value, int8_t accuracy_decimals) {
   if (accuracy_decimals < 0) {
     auto multiplier = powf(10.0f, accuracy_decimals);
     value = roundf(value * multiplier) / multiplier;
     accuracy_decimals = 0;
   }
-  char tmp[32];  // should be enough, but we should maybe improve this at some point.
-  snprintf(tmp, sizeof(tmp), "%.*f", accuracy_decimals, value);
-  return std::string(tmp);
+  int len = snprintf(buf, buf_len, "%.*f", accuracy_decimals, value);
+  if (len < 0)
+    return 0;
+  return std::min((size_t) len, buf_len - 1);
 }
 
 int8_t step_to_accuracy_decimals(float step) {
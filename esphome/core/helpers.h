@@ -448,6 +448,8 @@ ParseOnOffState parse_on_off(const char *str, const char *on = nullptr, const ch
 
 /// Create a string from a value and an accuracy in decimals.
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
+/// Format a value with an accuracy in decimals into a buffer, returns the length of the formatted value.
+size_t value_accuracy_to_buf(char *buf, size_t buf_len, float value, int8_t accuracy_decimals);
 
 /// Derive accuracy in decimals from an increment step.
 int8_t step_to_accuracy_decimals(float step);
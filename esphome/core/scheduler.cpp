@@ -5,11 +5,19 @@
 #include <algorithm>
 #include <cinttypes>
 
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+// Number of spare items kept around for reuse, beyond that finished items are freed
+static const size_t MAX_POOLED_ITEMS = 32;
+// Initial number of slots in the cancel index, must be a power of two
+static const size_t MIN_INDEX_CAPACITY = 16;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -17,66 +25,64 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 // A note on locking: the `lock_` lock protects the `items_` and `to_add_` containers. It must be taken when writing to
 // them (i.e. when adding/removing items, but not when changing items). As items are only deleted from the loop task,
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
-// avoid the main thread modifying the list while it is being accessed.
+// avoid the main thread modifying the list while it is being accessed. The same lock also protects the item pool, the
+// cancel index and the name table.
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
-  const uint32_t now = this->millis_();
-
-  if (!name.empty())
-    this->cancel_timeout(component, name);
-
-  if (timeout == SCHEDULER_DONT_RUN)
-    return;
-
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
-
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::TIMEOUT;
-  item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
-  item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  this->set_item_(component, name, SchedulerItem::TIMEOUT, timeout, std::move(func));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
+  return this->cancel_item_(component, this->find_name_id_(name), SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> func) {
-  const uint32_t now = this->millis_();
-
-  if (!name.empty())
-    this->cancel_interval(component, name);
-
-  if (interval == SCHEDULER_DONT_RUN)
-    return;
-
+  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ")", name.c_str(), interval);
+  this->set_item_(component, name, SchedulerItem::INTERVAL, interval, std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, this->find_name_id_(name), SchedulerItem::INTERVAL);
+}
+void HOT Scheduler::set_item_(Component *component, const std::string &name, SchedulerItem::Type type, uint32_t delay,
+                              std::function<void()> func) {
   // only put offset in lower half
   uint32_t offset = 0;
-  if (interval != 0)
-    offset = (random_uint32() % interval) / 2;
+  if (type == SchedulerItem::INTERVAL && delay != 0 && delay != SCHEDULER_DONT_RUN)
+    offset = (random_uint32() % delay) / 2;
 
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
+  LockGuard guard{this->lock_};
+  const uint64_t now = this->millis_64_();
+  if (delay == SCHEDULER_DONT_RUN) {
+    const uint32_t name_id = this->find_name_id_locked_(name);
+    if (name_id != 0)
+      this->cancel_item_locked_(component, name_id, type);
+    return;
+  }
+  // The new item holds a reference to its name, which keeps the id alive while the old item is cancelled
+  const uint32_t name_id = this->intern_name_(name);
+  if (name_id != 0)
+    this->cancel_item_locked_(component, name_id, type);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::INTERVAL;
-  item->interval = interval;
-  item->last_execution = now - offset - interval;
-  item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
-  item->callback = std::move(func);
+  item->name_id = name_id;
+  item->type = type;
   item->remove = false;
-  this->push_(std::move(item));
-}
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  item->wheel_level = WHEEL_DETACHED;
+#endif
+  item->interval = delay;
+  if (type == SchedulerItem::INTERVAL) {
+    // intervals run for the first time right away, spread out by the random offset
+    item->next_execution = now > offset ? now - offset : 0;
+  } else {
+    item->next_execution = now + delay;
+  }
+  item->callback = std::move(func);
+  if (name_id != 0)
+    this->index_insert_(item.get());
+  this->to_add_.push_back(std::move(item));
 }
 
 struct RetryArgs {
@@ -89,12 +95,13 @@ struct RetryArgs {
   Scheduler *scheduler;
 };
 
-static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
+void Scheduler::retry_handler_(const std::shared_ptr<RetryArgs> &args) {
   RetryResult const retry_result = args->func(--args->retry_countdown);
   if (retry_result == RetryResult::DONE || args->retry_countdown <= 0)
     return;
   // second execution of `func` happens after `initial_wait_time`
-  args->scheduler->set_timeout(args->component, args->name, args->current_interval, [args]() { retry_handler(args); });
+  args->scheduler->set_item_(args->component, args->name, SchedulerItem::TIMEOUT, args->current_interval,
+                             [args]() { retry_handler_(args); });
   // backoff_increase_factor applied to third & later executions
   args->current_interval *= args->backoff_increase_factor;
 }
@@ -128,42 +135,50 @@ void HOT Scheduler::set_retry(Component *component, const std::string &name, uin
   args->scheduler = this;
 
   // First execution of `func` immediately
-  this->set_timeout(component, args->name, 0, [args]() { retry_handler(args); });
+  this->set_item_(component, args->name, SchedulerItem::TIMEOUT, 0, [args]() { retry_handler_(args); });
 }
 bool HOT Scheduler::cancel_retry(Component *component, const std::string &name) {
   return this->cancel_timeout(component, "retry$" + name);
 }
 
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
+#ifndef USE_SCHEDULER_TIMING_WHEEL
+  // drop cancelled items from the top of the heap, so their deadline doesn't cause an early wakeup
   if (this->empty_())
     return {};
-  auto &item = this->items_[0];
-  const uint32_t now = this->millis_();
-  uint32_t next_time = item->last_execution + item->interval;
-  if (next_time < now)
+#endif
+  LockGuard guard{this->lock_};
+  auto next = this->next_deadline_();
+  if (!next.has_value())
+    return {};
+  const uint64_t now = this->millis_64_();
+  if (*next <= now)
     return 0;
-  return next_time - now;
+  return static_cast<uint32_t>(std::min<uint64_t>(*next - now, UINT32_MAX));
 }
 void HOT Scheduler::call() {
-  const uint32_t now = this->millis_();
+  uint64_t now;
+  {
+    LockGuard guard{this->lock_};
+    now = this->millis_64_();
+  }
   this->process_to_add();
 
-#ifdef ESPHOME_DEBUG_SCHEDULER
-  static uint32_t last_print = 0;
+#if defined(ESPHOME_DEBUG_SCHEDULER) && !defined(USE_SCHEDULER_TIMING_WHEEL)
+  static uint64_t last_print = 0;
 
   if (now - last_print > 2000) {
     last_print = now;
     std::vector<std::unique_ptr<SchedulerItem>> old_items;
-    ESP_LOGVV(TAG, "Items: count=%u, now=%" PRIu32, this->items_.size(), now);
+    ESP_LOGVV(TAG, "Items: count=%u, pool=%u, names=%u, now=%" PRIu64, this->items_.size(), this->item_pool_.size(),
+              this->name_ids_.size(), now);
     while (!this->empty_()) {
       this->lock_.lock();
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
+      auto item = this->pop_raw_();
       this->lock_.unlock();
 
-      ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " last_execution=%" PRIu32 " (%u) next=%" PRIu32 " (%u)",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution,
-                item->last_execution_major, item->next_execution(), item->next_execution_major());
+      ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " next=%" PRIu64, item->get_type_str(),
+                this->get_name_(item->name_id), item->interval, item->next_execution);
 
       old_items.push_back(std::move(item));
     }
@@ -176,6 +191,22 @@ void HOT Scheduler::call() {
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  {
+    LockGuard guard{this->lock_};
+    this->wheel_advance_(now);
+  }
+
+  while (true) {
+    std::unique_ptr<SchedulerItem> item;
+    {
+      // Items are detached from the due list before running, cancelling them during the callback only flags them
+      LockGuard guard{this->lock_};
+      item = this->wheel_pop_due_();
+    }
+    if (!item)
+      break;
+#else
   auto to_remove_was = to_remove_;
   auto items_was = this->items_.size();
   // If we have too many items to remove
@@ -183,9 +214,7 @@ void HOT Scheduler::call() {
     std::vector<std::unique_ptr<SchedulerItem>> valid_items;
     while (!this->empty_()) {
       LockGuard guard{this->lock_};
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
+      valid_items.push_back(this->pop_raw_());
     }
 
     {
@@ -202,66 +231,75 @@ void HOT Scheduler::call() {
   }
 
   while (!this->empty_()) {
-    // use scoping to indicate visibility of `item` variable
-    {
-      // Don't copy-by value yet
-      auto &item = this->items_[0];
-      if ((now - item->last_execution) < item->interval) {
-        // Not reached timeout yet, done for this call
-        break;
-      }
-      uint8_t major = item->next_execution_major();
-      if (this->millis_major_ - major > 1)
-        break;
-
-      // Don't run on failed components
-      if (item->component != nullptr && item->component->is_failed()) {
-        LockGuard guard{this->lock_};
-        this->pop_raw_();
-        continue;
-      }
+    // Don't copy-by value yet, the item stays in the heap while it runs so that cancelling it only flags it
+    auto &item = this->items_[0];
+    if (item->next_execution > now) {
+      // Not reached timeout yet, done for this call
+      break;
+    }
+#endif
+
+    // Don't run on failed components
+    if (item->component != nullptr && item->component->is_failed()) {
+      LockGuard guard{this->lock_};
+#ifndef USE_SCHEDULER_TIMING_WHEEL
+      auto failed = this->pop_raw_();
+#else
+      auto &failed = item;
+#endif
+      if (failed->name_id != 0)
+        this->index_erase_(failed.get());
+      this->recycle_item_(std::move(failed));
+      continue;
+    }
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " last_execution=%" PRIu32 " (now=%" PRIu32 ")",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution, now);
+    ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " next_execution=%" PRIu64 " (now=%" PRIu64 ")",
+              item->get_type_str(), this->get_name_(item->name_id), item->interval, item->next_execution, now);
 #endif
 
-      // Warning: During callback(), a lot of stuff can happen, including:
-      //  - timeouts/intervals get added, potentially invalidating vector pointers
-      //  - timeouts/intervals get cancelled
-      {
-        WarnIfComponentBlockingGuard guard{item->component};
-        item->callback();
-      }
+    // Warning: During callback(), a lot of stuff can happen, including:
+    //  - timeouts/intervals get added, potentially invalidating vector pointers
+    //  - timeouts/intervals get cancelled
+    {
+      WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_PROFILER
+      const uint32_t started = micros();
+      item->callback();
+      if (profiler::global_profiler != nullptr)
+        profiler::global_profiler->record_scheduler(item->component, micros() - started);
+#else
+      item->callback();
+#endif
     }
 
     {
-      this->lock_.lock();
+      LockGuard guard{this->lock_};
 
+#ifndef USE_SCHEDULER_TIMING_WHEEL
       // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
-
       // Only pop after function call, this ensures we were reachable
       // during the function call and know if we were cancelled.
-      this->pop_raw_();
-
-      this->lock_.unlock();
+      auto item = this->pop_raw_();
+#endif
 
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
       if (item->type == SchedulerItem::INTERVAL) {
         if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
+          const uint64_t amount = (now - item->next_execution) / item->interval + 1;
+          item->next_execution += amount * item->interval;
         }
-        this->push_(std::move(item));
+        this->to_add_.push_back(std::move(item));
+      } else {
+        if (item->name_id != 0)
+          this->index_erase_(item.get());
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -272,14 +310,186 @@ void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      to_remove_--;
+      this->recycle_item_(std::move(it));
       continue;
     }
 
-    this->items_.push_back(std::move(it));
-    std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+    this->push_(std::move(it));
   }
   this->to_add_.clear();
 }
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+optional<uint64_t> HOT Scheduler::next_deadline_() {
+  if (this->wheel_due_ != nullptr)
+    return this->wheel_due_->next_execution;
+  const uint64_t tick = this->wheel_now_;
+  const uint64_t bits = this->wheel_occupied_[0] & (~0ULL << (tick & WHEEL_SLOT_MASK));
+  if (bits != 0)
+    return (tick & ~WHEEL_SLOT_MASK) | __builtin_ctzll(bits);
+  // Higher levels only tell which block the next item is in, waking up at the block start is early enough
+  const uint64_t next = this->wheel_next_block_(tick);
+  if (next == UINT64_MAX)
+    return {};
+  return next;
+}
+void HOT Scheduler::push_(std::unique_ptr<SchedulerItem> item) { this->wheel_insert_(item.release()); }
+Scheduler::SchedulerItem **Scheduler::wheel_list_(uint8_t level, uint8_t slot) {
+  if (level == WHEEL_DUE)
+    return &this->wheel_due_;
+  if (level == WHEEL_OVERFLOW)
+    return &this->wheel_overflow_;
+  return &this->wheel_[level][slot];
+}
+void HOT Scheduler::wheel_link_(SchedulerItem *item, uint8_t level, uint8_t slot) {
+  item->wheel_level = level;
+  item->wheel_slot = slot;
+  item->wheel_prev = nullptr;
+  if (level == WHEEL_DUE) {
+    // The due list is kept in order by appending
+    item->wheel_prev = this->wheel_due_tail_;
+    item->wheel_next = nullptr;
+    if (this->wheel_due_tail_ != nullptr) {
+      this->wheel_due_tail_->wheel_next = item;
+    } else {
+      this->wheel_due_ = item;
+    }
+    this->wheel_due_tail_ = item;
+    return;
+  }
+  SchedulerItem **head = this->wheel_list_(level, slot);
+  item->wheel_next = *head;
+  if (*head != nullptr)
+    (*head)->wheel_prev = item;
+  *head = item;
+  if (level < WHEEL_LEVELS)
+    this->wheel_occupied_[level] |= 1ULL << slot;
+}
+void HOT Scheduler::wheel_unlink_(SchedulerItem *item) {
+  SchedulerItem **head = this->wheel_list_(item->wheel_level, item->wheel_slot);
+  if (item->wheel_prev != nullptr) {
+    item->wheel_prev->wheel_next = item->wheel_next;
+  } else {
+    *head = item->wheel_next;
+  }
+  if (item->wheel_next != nullptr) {
+    item->wheel_next->wheel_prev = item->wheel_prev;
+  } else if (item->wheel_level == WHEEL_DUE) {
+    this->wheel_due_tail_ = item->wheel_prev;
+  }
+  if (item->wheel_level < WHEEL_LEVELS && *head == nullptr)
+    this->wheel_occupied_[item->wheel_level] &= ~(1ULL << item->wheel_slot);
+  item->wheel_level = WHEEL_DETACHED;
+  item->wheel_prev = item->wheel_next = nullptr;
+}
+void HOT Scheduler::wheel_insert_(SchedulerItem *item) {
+  const uint64_t deadline = item->next_execution;
+  if (deadline < this->wheel_now_) {
+    this->wheel_link_(item, WHEEL_DUE, 0);
+    return;
+  }
+  // Use the lowest level whose current block (the range covered by one slot of the level above) contains the deadline
+  for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+    const uint8_t shift = WHEEL_SLOT_BITS * (level + 1);
+    if ((deadline >> shift) == (this->wheel_now_ >> shift)) {
+      this->wheel_link_(item, level, (deadline >> (shift - WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK);
+      return;
+    }
+  }
+  this->wheel_link_(item, WHEEL_OVERFLOW, 0);
+}
+void HOT Scheduler::wheel_advance_(uint64_t target) {
+  while (this->wheel_now_ <= target) {
+    const uint64_t tick = this->wheel_now_;
+    const uint64_t bits = this->wheel_occupied_[0] & (~0ULL << (tick & WHEEL_SLOT_MASK));
+    if (bits == 0) {
+      // Nothing left in this block, jump straight to the next block that has something to cascade
+      this->wheel_set_now_(std::min(this->wheel_next_block_(tick), target + 1));
+      continue;
+    }
+    const uint64_t next = (tick & ~WHEEL_SLOT_MASK) | __builtin_ctzll(bits);
+    if (next > target) {
+      this->wheel_set_now_(target + 1);
+      break;
+    }
+    SchedulerItem **head = &this->wheel_[0][next & WHEEL_SLOT_MASK];
+    while (*head != nullptr) {
+      SchedulerItem *item = *head;
+      this->wheel_unlink_(item);
+      this->wheel_link_(item, WHEEL_DUE, 0);
+    }
+    this->wheel_set_now_(next + 1);
+  }
+}
+void HOT Scheduler::wheel_set_now_(uint64_t tick) {
+  this->wheel_now_ = tick;
+  // Cascade as soon as a block begins, so that level 0 always holds everything due before the next block
+  if ((tick & WHEEL_SLOT_MASK) == 0)
+    this->wheel_cascade_(tick);
+}
+void HOT Scheduler::wheel_cascade_(uint64_t tick) {
+  // Find the highest level whose block starts at this tick, then cascade from the top down so that items trickle
+  // through all intermediate levels before level 0 is scanned.
+  uint8_t level = 1;
+  while (level < WHEEL_LEVELS && ((tick >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK) == 0)
+    level++;
+  if (level == WHEEL_LEVELS) {
+    this->wheel_cascade_list_(&this->wheel_overflow_);
+    level--;
+  }
+  for (; level > 0; level--) {
+    const uint8_t slot = (tick >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK;
+    if (this->wheel_occupied_[level] & (1ULL << slot))
+      this->wheel_cascade_list_(&this->wheel_[level][slot]);
+  }
+}
+void HOT Scheduler::wheel_cascade_list_(SchedulerItem **head) {
+  // Detach the whole list first, items may be re-inserted into the same list (overflow)
+  SchedulerItem *item = *head;
+  if (item == nullptr)
+    return;
+  const uint8_t level = item->wheel_level;
+  const uint8_t slot = item->wheel_slot;
+  *head = nullptr;
+  if (level < WHEEL_LEVELS)
+    this->wheel_occupied_[level] &= ~(1ULL << slot);
+  while (item != nullptr) {
+    SchedulerItem *next = item->wheel_next;
+    this->wheel_insert_(item);
+    item = next;
+  }
+}
+uint64_t HOT Scheduler::wheel_next_block_(uint64_t tick) {
+  // Items on a level are always in a later block than items on the levels below, so the first occupied level decides
+  for (uint8_t level = 1; level < WHEEL_LEVELS; level++) {
+    if (this->wheel_occupied_[level] == 0)
+      continue;
+    const uint8_t shift = WHEEL_SLOT_BITS * level;
+    const uint64_t block = (tick >> (shift + WHEEL_SLOT_BITS)) << (shift + WHEEL_SLOT_BITS);
+    return block | (uint64_t(__builtin_ctzll(this->wheel_occupied_[level])) << shift);
+  }
+  if (this->wheel_overflow_ == nullptr)
+    return UINT64_MAX;
+  const uint8_t shift = WHEEL_SLOT_BITS * WHEEL_LEVELS;
+  return ((tick >> shift) + 1) << shift;
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::wheel_pop_due_() {
+  SchedulerItem *item = this->wheel_due_;
+  if (item == nullptr)
+    return nullptr;
+  this->wheel_unlink_(item);
+  return std::unique_ptr<SchedulerItem>(item);
+}
+#else
+optional<uint64_t> HOT Scheduler::next_deadline_() {
+  if (this->items_.empty())
+    return {};
+  return this->items_[0]->next_execution;
+}
+void HOT Scheduler::push_(std::unique_ptr<SchedulerItem> item) {
+  this->items_.push_back(std::move(item));
+  std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+}
 void HOT Scheduler::cleanup_() {
   while (!this->items_.empty()) {
     auto &item = this->items_[0];
@@ -290,75 +500,179 @@ void HOT Scheduler::cleanup_() {
 
     {
       LockGuard guard{this->lock_};
-      this->pop_raw_();
+      this->recycle_item_(this->pop_raw_());
     }
   }
 }
-void HOT Scheduler::pop_raw_() {
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  auto item = std::move(this->items_.back());
   this->items_.pop_back();
+  return item;
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+#endif
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t name_id, Scheduler::SchedulerItem::Type type) {
+  if (name_id == 0)
+    return false;
+  // obtain lock because this function can be called from non-loop task context
   LockGuard guard{this->lock_};
-  this->to_add_.push_back(std::move(item));
+  return this->cancel_item_locked_(component, name_id, type);
+}
+bool HOT Scheduler::cancel_item_locked_(Component *component, uint32_t name_id, Scheduler::SchedulerItem::Type type) {
+  // Named items are unique per (component, name, type), so the index holds at most one live match
+  SchedulerItem *item = this->index_find_(component, name_id, type);
+  if (item == nullptr)
+    return false;
+  this->index_erase_(item);
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  if (item->wheel_level != WHEEL_DETACHED) {
+    // Linked into the wheel, so it can be dropped right away instead of being deleted lazily
+    this->wheel_unlink_(item);
+    this->recycle_item_(std::unique_ptr<SchedulerItem>(item));
+    return true;
+  }
+#endif
+  item->remove = true;
+  to_remove_++;
+  return true;
+}
+uint32_t Scheduler::intern_name_(const std::string &name) {
+  if (name.empty())
+    return 0;
+  auto it = this->name_ids_.find(name);
+  if (it != this->name_ids_.end()) {
+    this->names_[it->second - 1].refs++;
+    return it->second;
+  }
+  uint32_t name_id;
+  if (this->free_name_ids_.empty()) {
+    this->names_.push_back({});
+    name_id = this->names_.size();
+  } else {
+    name_id = this->free_name_ids_.back();
+    this->free_name_ids_.pop_back();
+  }
+  auto res = this->name_ids_.emplace(name, name_id);
+  this->names_[name_id - 1] = {&res.first->first, 1};
+  return name_id;
+}
+void Scheduler::release_name_(uint32_t name_id) {
+  NameEntry &entry = this->names_[name_id - 1];
+  if (--entry.refs != 0)
+    return;
+  // Names built at runtime would pile up otherwise, the id is reused by the next new name
+  this->name_ids_.erase(*entry.name);
+  entry.name = nullptr;
+  this->free_name_ids_.push_back(name_id);
 }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
-  // obtain lock because this function iterates and can be called from non-loop task context
+uint32_t Scheduler::find_name_id_(const std::string &name) {
+  if (name.empty())
+    return 0;
   LockGuard guard{this->lock_};
-  bool ret = false;
-  for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
+  return this->find_name_id_locked_(name);
+}
+uint32_t Scheduler::find_name_id_locked_(const std::string &name) {
+  if (name.empty())
+    return 0;
+  auto it = this->name_ids_.find(name);
+  if (it == this->name_ids_.end())
+    return 0;
+  return it->second;
+}
+const char *Scheduler::get_name_(uint32_t name_id) {
+  if (name_id == 0 || name_id > this->names_.size() || this->names_[name_id - 1].name == nullptr)
+    return "";
+  return this->names_[name_id - 1].name->c_str();
+}
+std::unique_ptr<Scheduler::SchedulerItem> Scheduler::acquire_item_() {
+  if (this->item_pool_.empty())
+    return make_unique<SchedulerItem>();
+  auto item = std::move(this->item_pool_.back());
+  this->item_pool_.pop_back();
+  return item;
+}
+void Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // Release captured state (e.g. shared_ptrs held by lambdas) right away, even if the item itself is kept
+  item->callback = nullptr;
+  if (item->name_id != 0) {
+    this->release_name_(item->name_id);
+    item->name_id = 0;
+  }
+  if (this->item_pool_.size() < MAX_POOLED_ITEMS)
+    this->item_pool_.push_back(std::move(item));
+}
+uint32_t Scheduler::index_hash_(Component *component, uint32_t name_id, SchedulerItem::Type type) {
+  auto ptr = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component) >> 2);
+  return (ptr * 2654435761UL) ^ (name_id * 2246822519UL) ^ type;
+}
+Scheduler::SchedulerItem *Scheduler::index_find_(Component *component, uint32_t name_id, SchedulerItem::Type type) {
+  if (this->index_size_ == 0)
+    return nullptr;
+  const size_t mask = this->index_.size() - 1;
+  for (size_t i = index_hash_(component, name_id, type) & mask;; i = (i + 1) & mask) {
+    SchedulerItem *item = this->index_[i];
+    if (item == nullptr)
+      return nullptr;
+    if (item->component == component && item->name_id == name_id && item->type == type)
+      return item;
+  }
+}
+void Scheduler::index_insert_(SchedulerItem *item) {
+  // Keep the load factor at or below 1/2 so probe sequences stay short
+  if ((this->index_size_ + 1) * 2 > this->index_.size()) {
+    std::vector<SchedulerItem *> old = std::move(this->index_);
+    this->index_.assign(old.empty() ? MIN_INDEX_CAPACITY : old.size() * 2, nullptr);
+    this->index_size_ = 0;
+    for (auto *it : old) {
+      if (it != nullptr)
+        this->index_insert_(it);
     }
   }
-  for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+  const size_t mask = this->index_.size() - 1;
+  size_t i = index_hash_(item->component, item->name_id, item->type) & mask;
+  while (this->index_[i] != nullptr)
+    i = (i + 1) & mask;
+  this->index_[i] = item;
+  this->index_size_++;
+}
+void Scheduler::index_erase_(SchedulerItem *item) {
+  if (this->index_size_ == 0)
+    return;
+  const size_t mask = this->index_.size() - 1;
+  size_t i = index_hash_(item->component, item->name_id, item->type) & mask;
+  while (this->index_[i] != item) {
+    if (this->index_[i] == nullptr)
+      return;
+    i = (i + 1) & mask;
+  }
+  // Backward-shift deletion: move later entries of the same probe chain into the hole, no tombstones needed
+  for (size_t j = (i + 1) & mask; this->index_[j] != nullptr; j = (j + 1) & mask) {
+    SchedulerItem *other = this->index_[j];
+    size_t home = index_hash_(other->component, other->name_id, other->type) & mask;
+    // Entry at j can fill the hole at i only if its home slot is not cyclically within (i, j]
+    if (((j - home) & mask) >= ((j - i) & mask)) {
+      this->index_[i] = other;
+      i = j;
     }
   }
-
-  return ret;
+  this->index_[i] = nullptr;
+  this->index_size_--;
 }
-uint32_t Scheduler::millis_() {
+uint64_t Scheduler::millis_64_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
     ESP_LOGD(TAG, "Incrementing scheduler major");
     this->millis_major_++;
   }
   this->last_millis_ = now;
-  return now;
+  return (static_cast<uint64_t>(this->millis_major_) << 32) | now;
 }
 
 bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
                                        const std::unique_ptr<SchedulerItem> &b) {
   // min-heap
   // return true if *a* will happen after *b*
-  uint32_t a_next_exec = a->next_execution();
-  uint8_t a_next_exec_major = a->next_execution_major();
-  uint32_t b_next_exec = b->next_execution();
-  uint8_t b_next_exec_major = b->next_execution_major();
-
-  if (a_next_exec_major != b_next_exec_major) {
-    // The "major" calculation is quite complicated.
-    // Basically, we need to check if the major value lies in the future or
-    //
-
-    // Here are some cases to think about:
-    // Format: a_major,b_major -> expected result (a-b, b-a)
-    // a=255,b=0 -> false (255, 1)
-    // a=0,b=1 -> false   (255, 1)
-    // a=1,b=0 -> true    (1, 255)
-    // a=0,b=255 -> true  (1, 255)
-
-    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
-    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
-    return diff1 < diff2;
-  }
-
-  return a_next_exec > b_next_exec;
+  return a->next_execution > b->next_execution;
 }
 
 }  // namespace esphome
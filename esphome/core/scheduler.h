@@ -2,13 +2,16 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
 
 class Component;
+struct RetryArgs;
 
 class Scheduler {
  public:
@@ -30,25 +33,21 @@ class Scheduler {
  protected:
   struct SchedulerItem {
     Component *component;
-    std::string name;
-    enum Type { TIMEOUT, INTERVAL } type;
-    union {
-      uint32_t interval;
-      uint32_t timeout;
-    };
-    uint32_t last_execution;
-    std::function<void()> callback;
+    /// Interned name of this item, 0 if the item has no name and can't be cancelled.
+    uint32_t name_id;
+    enum Type : uint8_t { TIMEOUT, INTERVAL } type;
     bool remove;
-    uint8_t last_execution_major;
-
-    inline uint32_t next_execution() { return this->last_execution + this->timeout; }
-    inline uint8_t next_execution_major() {
-      uint32_t next_exec = this->next_execution();
-      uint8_t next_exec_major = this->last_execution_major;
-      if (next_exec < this->last_execution)
-        next_exec_major++;
-      return next_exec_major;
-    }
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+    /// Wheel level the item is linked into, or one of the WHEEL_* list markers.
+    uint8_t wheel_level;
+    uint8_t wheel_slot;
+    SchedulerItem *wheel_prev;
+    SchedulerItem *wheel_next;
+#endif
+    uint32_t interval;
+    /// Absolute time of the next execution, on the 64-bit scheduler clock (see millis_64_()).
+    uint64_t next_execution;
+    std::function<void()> callback;
 
     static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
     const char *get_type_str() {
@@ -63,21 +62,107 @@ class Scheduler {
     }
   };
 
-  uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
+  void set_item_(Component *component, const std::string &name, SchedulerItem::Type type, uint32_t delay,
+                 std::function<void()> func);
+  bool cancel_item_(Component *component, uint32_t name_id, SchedulerItem::Type type);
+  bool cancel_item_locked_(Component *component, uint32_t name_id, SchedulerItem::Type type);
+  static void retry_handler_(const std::shared_ptr<RetryArgs> &args);
+
+  /** Map a timer name to a numeric id and take a reference to it, 0 is reserved for the empty name. Lock must be held.
+   *
+   * Every item with a name holds one reference, released in recycle_item_(). The id stays the same while any item
+   * uses the name and is freed with the last one.
+   */
+  uint32_t intern_name_(const std::string &name);
+  /// Drop a reference taken by intern_name_(). Lock must be held.
+  void release_name_(uint32_t name_id);
+  /// Look up the id of a name without interning it, 0 if no item uses the name.
+  uint32_t find_name_id_(const std::string &name);
+  uint32_t find_name_id_locked_(const std::string &name);
+  const char *get_name_(uint32_t name_id);
+
+  /// Take a recycled item from the pool, or allocate a new one if the pool is empty. Lock must be held.
+  std::unique_ptr<SchedulerItem> acquire_item_();
+  /// Return an item to the pool once it is no longer referenced by the heap or the index. Lock must be held.
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+
+  // Open-addressing index of all named, non-removed items, keyed by (component, name_id, type). Lock must be held.
+  static uint32_t index_hash_(Component *component, uint32_t name_id, SchedulerItem::Type type);
+  SchedulerItem *index_find_(Component *component, uint32_t name_id, SchedulerItem::Type type);
+  void index_insert_(SchedulerItem *item);
+  void index_erase_(SchedulerItem *item);
+
+  /// Milliseconds since boot extended to 64 bits, so deadlines never roll over. Lock must be held.
+  uint64_t millis_64_();
+  /// Absolute time of the earliest pending item, if any. Lock must be held.
+  optional<uint64_t> next_deadline_();
+  /// Queue an item for execution in its backend. Lock must be held.
   void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  // Hierarchical timing wheel: level 0 has one slot per millisecond, every level above covers 64 slots of the one
+  // below. Items are linked into the slot matching their deadline and cascaded down a level when their slot's block
+  // begins; the occupancy bitmaps let empty stretches of time be skipped in one step.
+  static constexpr uint8_t WHEEL_LEVELS = 4;
+  static constexpr uint8_t WHEEL_SLOT_BITS = 6;
+  static constexpr uint8_t WHEEL_SLOTS = 1 << WHEEL_SLOT_BITS;
+  static constexpr uint64_t WHEEL_SLOT_MASK = WHEEL_SLOTS - 1;
+  // List markers stored in SchedulerItem::wheel_level for items not linked into a wheel slot
+  static constexpr uint8_t WHEEL_DETACHED = 0xFF;
+  static constexpr uint8_t WHEEL_DUE = 0xFE;
+  static constexpr uint8_t WHEEL_OVERFLOW = 0xFD;
+
+  SchedulerItem **wheel_list_(uint8_t level, uint8_t slot);
+  void wheel_link_(SchedulerItem *item, uint8_t level, uint8_t slot);
+  void wheel_unlink_(SchedulerItem *item);
+  void wheel_insert_(SchedulerItem *item);
+  /// Move everything due at or before target onto the due list.
+  void wheel_advance_(uint64_t target);
+  void wheel_set_now_(uint64_t tick);
+  /// Re-insert all items of the blocks starting at tick (which must be a level 0 block boundary).
+  void wheel_cascade_(uint64_t tick);
+  void wheel_cascade_list_(SchedulerItem **head);
+  /// Earliest block boundary after tick at which some item could become due, assuming level 0 is empty.
+  uint64_t wheel_next_block_(uint64_t tick);
+  std::unique_ptr<SchedulerItem> wheel_pop_due_();
+#else
+  void cleanup_();
+  std::unique_ptr<SchedulerItem> pop_raw_();
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
   }
+#endif
 
   Mutex lock_;
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  SchedulerItem *wheel_[WHEEL_LEVELS][WHEEL_SLOTS]{};
+  uint64_t wheel_occupied_[WHEEL_LEVELS]{};
+  /// Items beyond the range of the top level, re-inserted whenever a top level block begins.
+  SchedulerItem *wheel_overflow_{nullptr};
+  /// Items whose deadline has passed, in deadline order.
+  SchedulerItem *wheel_due_{nullptr};
+  SchedulerItem *wheel_due_tail_{nullptr};
+  /// Next tick the wheel has not processed yet.
+  uint64_t wheel_now_{0};
+#else
   std::vector<std::unique_ptr<SchedulerItem>> items_;
+#endif
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  std::vector<std::unique_ptr<SchedulerItem>> item_pool_;
+  std::vector<SchedulerItem *> index_;
+  size_t index_size_{0};
+  struct NameEntry {
+    /// Key in name_ids_, nullptr once the id is free.
+    const std::string *name;
+    uint32_t refs;
+  };
+  std::unordered_map<std::string, uint32_t> name_ids_;
+  /// Indexed by name id - 1.
+  std::vector<NameEntry> names_;
+  std::vector<uint32_t> free_name_ids_;
   uint32_t last_millis_{0};
-  uint8_t millis_major_{0};
+  uint32_t millis_major_{0};
   uint32_t to_remove_{0};
 };
 